@@ -0,0 +1,78 @@
+#ifndef GRAPH_SHAPES_HPP
+#define GRAPH_SHAPES_HPP
+
+#include <utility>
+#include <vector>
+#include "graph_generator.hpp"
+
+// Формы входных графов для бенчмарков поверх GraphGenerator.
+// Вершины нумеруются с 0, зерно фиксировано.
+enum class Shape {
+    Random = 0,     // случайный граф со средней степенью ~8
+    Path = 1,       // длинная цепочка (глубокий DFS)
+    Grid = 2,       // квадратная решётка
+    Star = 3        // звезда (одна вершина большой степени)
+};
+
+inline const char* shapeName(Shape shape) {
+    switch (shape) {
+        case Shape::Random: return "random";
+        case Shape::Path: return "path";
+        case Shape::Grid: return "grid";
+        case Shape::Star: return "star";
+    }
+    return "unknown";
+}
+
+inline std::vector<std::pair<int, int>> makeUndirectedEdges(Shape shape, int n) {
+    GraphGenerator generator(12345);
+    return GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        switch (shape) {
+            case Shape::Random:
+                // Дерево гарантирует связность, поверх него ~3n случайных рёбер
+                generator.randomTree(n, sink);
+                generator.erdosRenyi(n, 3LL * n, false, sink);
+                break;
+            case Shape::Path:
+                generator.path(n, sink);
+                break;
+            case Shape::Grid: {
+                int side = 1;
+                while (side * side < n) {
+                    ++side;
+                }
+                generator.grid(n / side, side, sink);
+                break;
+            }
+            case Shape::Star:
+                generator.broom(n, 1, sink);
+                break;
+        }
+    });
+}
+
+// Случайный ориентированный граф с ~m рёбрами
+inline std::vector<std::pair<int, int>> makeDirectedEdges(int n, long long m) {
+    GraphGenerator generator(54321);
+    return GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        generator.erdosRenyi(n, m, true, sink);
+    });
+}
+
+// Случайный DAG с ~m рёбрами
+inline std::vector<std::pair<int, int>> makeDagEdges(int n, long long m) {
+    GraphGenerator generator(777);
+    return GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        generator.randomDag(n, m, sink);
+    });
+}
+
+// Слоистая сеть: исток 0, сток layers * width + 1
+inline std::vector<std::pair<int, int>> makeLayeredNetwork(int layers, int width) {
+    GraphGenerator generator(2024);
+    return GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        generator.layeredNetwork(layers, width, 3, sink);
+    });
+}
+
+#endif
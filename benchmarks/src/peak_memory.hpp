@@ -0,0 +1,38 @@
+#ifndef PEAK_MEMORY_HPP
+#define PEAK_MEMORY_HPP
+
+#include <fstream>
+#include <string>
+
+// Пиковый RSS процесса (VmHWM) для бенчмарков памяти. resetPeakRss()
+// сбрасывает пик до текущего RSS (Linux 4.0+); где это недоступно,
+// функции возвращают false и 0, и счётчик просто не заполняется.
+inline bool resetPeakRss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    return static_cast<bool>(clear_refs.flush());
+}
+
+inline long long peakRssBytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoll(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+inline long long currentRssBytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            return std::stoll(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+#endif
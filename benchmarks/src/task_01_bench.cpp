@@ -0,0 +1,302 @@
+#include <benchmark/benchmark.h>
+#include "graph_shapes.hpp"
+#include "network_analyzer.hpp"
+#include "block_cut_index.hpp"
+#include "incremental_biconnectivity.hpp"
+#include "failure_oracle.hpp"
+#include "graph_generator.hpp"
+#include <algorithm>
+#include <memory_resource>
+#include <set>
+
+// Мосты и точки сочленения: аргументы - число вершин и форма графа
+static void runFindCriticalElements(benchmark::State& state, ScratchWorkspace* workspace) {
+    int n = static_cast<int>(state.range(0));
+    Shape shape = static_cast<Shape>(state.range(1));
+    auto edges = makeUndirectedEdges(shape, n);
+
+    NetworkAnalyzer analyzer(n);
+    for (const auto& [u, v] : edges) {
+        analyzer.addEdge(u + 1, v + 1);
+    }
+
+    // С рабочей памятью ответ пишется в переиспользуемые буферы
+    std::vector<int> articulation_points;
+    std::vector<std::pair<int, int>> bridges;
+    for (auto _ : state) {
+        if (workspace != nullptr) {
+            analyzer.findCriticalElements(*workspace, articulation_points, bridges);
+            benchmark::DoNotOptimize(bridges.data());
+        } else {
+            auto result = analyzer.findCriticalElements();
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    state.SetLabel(shapeName(shape));
+    state.counters["vertices"] = n;
+    state.counters["edges"] = static_cast<double>(edges.size());
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(edges.size()));
+}
+
+static void BM_FindCriticalElements(benchmark::State& state) {
+    runFindCriticalElements(state, nullptr);
+}
+
+// Рабочая память переиспользуется между итерациями
+static void BM_FindCriticalElementsWorkspace(benchmark::State& state) {
+    ScratchWorkspace workspace;
+    runFindCriticalElements(state, &workspace);
+}
+
+BENCHMARK(BM_FindCriticalElements)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {0, 1, 2, 3}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FindCriticalElementsWorkspace)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Прежняя реализация: std::set для точек сочленения и отдельный массив цветов.
+// Оставлена только для сравнения объёма памяти и скорости
+namespace {
+
+enum class ReferenceColor { White, Gray, Black };
+
+std::pair<std::vector<int>, std::vector<std::pair<int, int>>>
+referenceCriticalElements(const NetworkAnalyzer& analyzer, ScratchWorkspace& workspace) {
+    workspace.reset();
+    const CsrGraph& graph = analyzer.getAdjacencyList();
+    int n = analyzer.getVerticesCount();
+
+    auto tin = workspace.makeVector<int>(n + 1, 0);
+    auto low = workspace.makeVector<int>(n + 1, 0);
+    auto colors = workspace.makeVector<ReferenceColor>(n + 1, ReferenceColor::White);
+    std::pmr::set<int> points(workspace.getResource());
+    std::vector<std::pair<int, int>> bridges;
+    int timer = 0;
+
+    struct Visitor : DfsVisitor {
+        int root;
+        std::pmr::vector<int>& tin;
+        std::pmr::vector<int>& low;
+        std::pmr::vector<ReferenceColor>& colors;
+        int& timer;
+        std::pmr::set<int>& points;
+        std::vector<std::pair<int, int>>& bridges;
+        int root_children = 0;
+
+        void enter(int v, int) {
+            colors[v] = ReferenceColor::Gray;
+            tin[v] = low[v] = timer++;
+        }
+
+        DfsAction edge(int v, int parent, int to, long long) {
+            if (to == parent) {
+                return DfsAction::Skip;
+            }
+            if (colors[to] == ReferenceColor::White) {
+                return DfsAction::Descend;
+            }
+            low[v] = std::min(low[v], tin[to]);
+            return DfsAction::Skip;
+        }
+
+        void retreat(int v, int child, long long) {
+            low[v] = std::min(low[v], low[child]);
+            if (low[child] > tin[v]) {
+                bridges.push_back({std::min(v, child), std::max(v, child)});
+            }
+            if (v == root) {
+                root_children++;
+            } else if (low[child] >= tin[v]) {
+                points.insert(v);
+            }
+        }
+
+        void leave(int v, int) {
+            if (v == root && root_children > 1) {
+                points.insert(v);
+            }
+            colors[v] = ReferenceColor::Black;
+        }
+    };
+
+    DfsEngine engine(workspace.getResource());
+    for (int v = 1; v <= n; ++v) {
+        if (colors[v] == ReferenceColor::White) {
+            Visitor visitor{{}, v, tin, low, colors, timer, points, bridges};
+            engine.run(graph, v, visitor);
+        }
+    }
+
+    std::sort(bridges.begin(), bridges.end());
+    return {std::vector<int>(points.begin(), points.end()), bridges};
+}
+
+}
+
+// Плоское состояние против прежнего: scratch_bytes - сколько рабочей памяти
+// понадобилось поиску (tin/low, отметки точек, стек DFS)
+static void runCriticalStateLayout(benchmark::State& state, bool reference) {
+    int n = static_cast<int>(state.range(0));
+    Shape shape = static_cast<Shape>(state.range(1));
+
+    NetworkAnalyzer analyzer(n);
+    {
+        auto edges = makeUndirectedEdges(shape, n);
+        for (const auto& [u, v] : edges) {
+            analyzer.addEdge(u + 1, v + 1);
+        }
+    }
+    long long edges_count = analyzer.getAdjacencyList().getEdgesCount() / 2;
+
+    ScratchWorkspace workspace;
+    for (auto _ : state) {
+        auto result = reference ? referenceCriticalElements(analyzer, workspace)
+                                : analyzer.findCriticalElements(workspace);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetLabel(shapeName(shape));
+    state.counters["vertices"] = n;
+    state.counters["scratch_bytes"] = static_cast<double>(workspace.getCapacity());
+    state.SetItemsProcessed(state.iterations() * edges_count);
+}
+
+static void BM_CriticalStateReference(benchmark::State& state) {
+    runCriticalStateLayout(state, true);
+}
+
+static void BM_CriticalStateFlat(benchmark::State& state) {
+    runCriticalStateLayout(state, false);
+}
+
+// 10^7 вершин - целевой размер; запускать фильтром, сборка графа долгая
+BENCHMARK(BM_CriticalStateReference)
+    ->ArgsProduct({{1 << 16, 1 << 20, 10000000}, {0, 1, 3}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CriticalStateFlat)
+    ->ArgsProduct({{1 << 16, 1 << 20, 10000000}, {0, 1, 3}})
+    ->Unit(benchmark::kMillisecond);
+
+// Тарьян - Вишкин: третий аргумент - число потоков
+static void BM_FindCriticalElementsParallel(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    Shape shape = static_cast<Shape>(state.range(1));
+    int threads = static_cast<int>(state.range(2));
+    auto edges = makeUndirectedEdges(shape, n);
+
+    NetworkAnalyzer analyzer(n);
+    for (const auto& [u, v] : edges) {
+        analyzer.addEdge(u + 1, v + 1);
+    }
+
+    for (auto _ : state) {
+        auto result = analyzer.findCriticalElementsParallel(threads);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetLabel(shapeName(shape));
+    state.counters["vertices"] = n;
+    state.counters["edges"] = static_cast<double>(edges.size());
+    state.counters["threads"] = threads;
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(edges.size()));
+}
+
+BENCHMARK(BM_FindCriticalElementsParallel)
+    ->ArgsProduct({{1 << 14, 1 << 18}, {0, 2}, {1, 4, 8}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// Запросы «разделяет ли отказ роутера x вершины u и v» к готовому индексу
+static void BM_BlockCutVertexQueries(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    Shape shape = static_cast<Shape>(state.range(1));
+    auto edges = makeUndirectedEdges(shape, n);
+
+    NetworkAnalyzer analyzer(n);
+    for (const auto& [u, v] : edges) {
+        analyzer.addEdge(u + 1, v + 1);
+    }
+    BlockCutIndex index(analyzer);
+    SeededRandom random(1);
+
+    for (auto _ : state) {
+        int u = 1 + static_cast<int>(random.nextBelow(n));
+        int v = 1 + static_cast<int>(random.nextBelow(n));
+        int x = 1 + static_cast<int>(random.nextBelow(n));
+        benchmark::DoNotOptimize(index.separatedByVertex(u, v, x));
+    }
+
+    state.SetLabel(shapeName(shape));
+    state.counters["vertices"] = n;
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_BlockCutVertexQueries)
+    ->ArgsProduct({{1 << 14, 1 << 18}, {0, 1, 2, 3}});
+
+// Вставка всех рёбер по одному с поддержкой мостов и точек сочленения
+static void BM_IncrementalCriticalElements(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    Shape shape = static_cast<Shape>(state.range(1));
+    auto edges = makeUndirectedEdges(shape, n);
+
+    for (auto _ : state) {
+        IncrementalBiconnectivity incremental(n);
+        for (const auto& [u, v] : edges) {
+            incremental.addEdge(u + 1, v + 1);
+        }
+        benchmark::DoNotOptimize(incremental.getBridgesCount());
+    }
+
+    state.SetLabel(shapeName(shape));
+    state.counters["vertices"] = n;
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(edges.size()));
+}
+
+BENCHMARK(BM_IncrementalCriticalElements)
+    ->ArgsProduct({{1 << 14, 1 << 18}, {0, 1, 2, 3}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Пакет сценариев по 1-3 отказавших роутера и до 4 оборванных кабелей;
+// третий аргумент - число потоков
+static void BM_FailureScenarios(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    Shape shape = static_cast<Shape>(state.range(1));
+    int threads = static_cast<int>(state.range(2));
+    auto edges = makeUndirectedEdges(shape, n);
+
+    NetworkAnalyzer analyzer(n);
+    for (const auto& [u, v] : edges) {
+        analyzer.addEdge(u + 1, v + 1);
+    }
+    FailureOracle oracle(analyzer);
+
+    SeededRandom random(3);
+    std::vector<FailureScenario> scenarios(4096);
+    for (FailureScenario& scenario : scenarios) {
+        for (int i = 1 + static_cast<int>(random.nextBelow(3)); i > 0; --i) {
+            scenario.routers.push_back(1 + static_cast<int>(random.nextBelow(n)));
+        }
+        for (int i = static_cast<int>(random.nextBelow(5)); i > 0; --i) {
+            const auto& [u, v] = edges[random.nextBelow(edges.size())];
+            scenario.cables.push_back({u + 1, v + 1});
+        }
+    }
+
+    for (auto _ : state) {
+        auto result = oracle.countComponentsBatch(scenarios, threads);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetLabel(shapeName(shape));
+    state.counters["vertices"] = n;
+    state.counters["threads"] = threads;
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(scenarios.size()));
+}
+
+BENCHMARK(BM_FailureScenarios)
+    ->ArgsProduct({{1 << 14, 1 << 18}, {0, 2}, {1, 4}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,180 @@
+#include <benchmark/benchmark.h>
+#include "city_connector.hpp"
+#include "graph_shapes.hpp"
+#include "peak_memory.hpp"
+#include "graph_generator.hpp"
+#include <algorithm>
+
+// Число дорог до сильной связности на случайном ориентированном графе
+static void BM_FindMinRoadsToConnect(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    long long m = static_cast<long long>(n) * state.range(1);
+    auto edges = makeDirectedEdges(n, m);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        CityConnector connector(n);
+        for (const auto& [u, v] : edges) {
+            connector.addRoad(u + 1, v + 1);
+        }
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(connector.findMinRoadsToConnect());
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["edges"] = static_cast<double>(edges.size());
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(edges.size()));
+}
+
+// Второй аргумент - средняя исходящая степень
+BENCHMARK(BM_FindMinRoadsToConnect)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {1, 4}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Пирс против Косарайю на одном и том же готовом графе: первый аргумент -
+// число вершин, второй - средняя степень (2^21 * 5 ~ 10^7 рёбер).
+// peak_extra_bytes - сколько памяти сверх графа понадобилось поиску
+static void runSccAlgorithm(benchmark::State& state, SccAlgorithm algorithm) {
+    int n = static_cast<int>(state.range(0));
+    long long m = static_cast<long long>(n) * state.range(1);
+    CityConnector connector(CsrGraph::fromEdges(n, makeDirectedEdges(n, m)));
+
+    long long peak_extra = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        bool tracked = resetPeakRss();
+        long long before = currentRssBytes();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(connector.findMinRoadsToConnect(algorithm));
+
+        state.PauseTiming();
+        if (tracked) {
+            peak_extra = std::max(peak_extra, peakRssBytes() - before);
+        }
+        state.ResumeTiming();
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["components"] = connector.getComponentsCount();
+    state.counters["peak_extra_bytes"] = static_cast<double>(peak_extra);
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+static void BM_SccPearce(benchmark::State& state) {
+    runSccAlgorithm(state, SccAlgorithm::Pearce);
+}
+
+static void BM_SccKosaraju(benchmark::State& state) {
+    runSccAlgorithm(state, SccAlgorithm::Kosaraju);
+}
+
+BENCHMARK(BM_SccPearce)
+    ->ArgsProduct({{1 << 16, 1 << 21}, {1, 5}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SccKosaraju)
+    ->ArgsProduct({{1 << 16, 1 << 21}, {1, 5}})
+    ->Unit(benchmark::kMillisecond);
+
+// Параллельный поиск на степенном графе R-MAT: аргументы - scale (2^scale
+// вершин), средняя степень и число потоков; 2^23 * 12 ~ 10^8 рёбер
+static void BM_SccParallelRmat(benchmark::State& state) {
+    int scale = static_cast<int>(state.range(0));
+    int n = 1 << scale;
+    long long m = static_cast<long long>(n) * state.range(1);
+    int threads = static_cast<int>(state.range(2));
+    GraphGenerator generator(777);
+    auto edges = GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        generator.rmat(scale, m, sink);
+    });
+    CityConnector connector(CsrGraph::fromEdges(n, edges));
+    edges = {};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(connector.findMinRoadsToConnect(
+            threads == 0 ? SccAlgorithm::Pearce : SccAlgorithm::Parallel, threads));
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["threads"] = threads;
+    state.counters["components"] = connector.getComponentsCount();
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+// threads = 0 - последовательный Пирс для сравнения
+BENCHMARK(BM_SccParallelRmat)
+    ->ArgsProduct({{18, 23}, {12}, {0, 1, 8, 32}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Поток новых дорог с ответом после каждой: аргументы - число вершин
+// (средняя степень 4) и режим: 0 - полный пересчёт Пирсом, 1 - инкрементальный.
+// items - обработанные дороги
+static void BM_IncrementalRoads(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    bool incremental = state.range(1) != 0;
+    // Генератор может вернуть меньше рёбер, чем просили: поток - последние 256
+    auto edges = makeDirectedEdges(n, 4LL * n + 256);
+    std::size_t m = edges.size() - 256;
+    std::vector<std::pair<int, int>> initial(edges.begin(), edges.begin() + m);
+    // Полный пересчёт после каждой дороги дорог, поэтому его поток короче
+    std::size_t updates = incremental ? edges.size() - m : 16;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        CityConnector connector(CsrGraph::fromEdges(n, initial));
+        if (incremental) {
+            connector.enableIncrementalMode();
+        }
+        state.ResumeTiming();
+
+        for (std::size_t i = 0; i < updates; ++i) {
+            const auto& [u, v] = edges[m + i];
+            connector.addRoad(u + 1, v + 1);
+            benchmark::DoNotOptimize(connector.findMinRoadsToConnect());
+        }
+    }
+
+    state.counters["vertices"] = n;
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(updates));
+}
+
+BENCHMARK(BM_IncrementalRoads)
+    ->ArgsProduct({{1 << 14, 1 << 18}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+// Сами дороги по Эсварану - Тарьяну на готовом графе: аргументы - число
+// вершин и средняя степень (при степени 1 истоков и стоков много).
+// peak_extra_bytes - память сверх графа вместе с поиском компонент
+static void BM_RoadsToConnect(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    long long m = static_cast<long long>(n) * state.range(1);
+    CityConnector connector(CsrGraph::fromEdges(n, makeDirectedEdges(n, m)));
+
+    long long peak_extra = 0;
+    std::size_t roads = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        bool tracked = resetPeakRss();
+        long long before = currentRssBytes();
+        state.ResumeTiming();
+
+        roads = connector.findRoadsToConnect().size();
+
+        state.PauseTiming();
+        if (tracked) {
+            peak_extra = std::max(peak_extra, peakRssBytes() - before);
+        }
+        state.ResumeTiming();
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["roads"] = static_cast<double>(roads);
+    state.counters["peak_extra_bytes"] = static_cast<double>(peak_extra);
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+BENCHMARK(BM_RoadsToConnect)
+    ->ArgsProduct({{1 << 16, 10000000}, {1, 3}})
+    ->Unit(benchmark::kMillisecond);
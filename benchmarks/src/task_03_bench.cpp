@@ -0,0 +1,222 @@
+#include <benchmark/benchmark.h>
+#include "graph_shapes.hpp"
+#include "dag_executor.hpp"
+#include "topological_sorter.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+
+// Топологическая сортировка случайного DAG
+static void BM_TopologicalSort(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    long long m = static_cast<long long>(n) * state.range(1);
+    auto edges = makeDagEdges(n, m);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        TopologicalSorter sorter(n);
+        for (const auto& [u, v] : edges) {
+            sorter.addEdge(u + 1, v + 1);
+        }
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(sorter.sort());
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["edges"] = static_cast<double>(edges.size());
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(edges.size()));
+}
+
+// Второй аргумент - средняя исходящая степень
+BENCHMARK(BM_TopologicalSort)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {1, 4}})
+    ->Unit(benchmark::kMicrosecond);
+
+// DFS против Кана по уровням на готовом графе: аргументы - число вершин,
+// средняя степень (2^22 * 12 ~ 5 * 10^7 рёбер) и число потоков Кана;
+// threads = 0 - последовательный DFS для сравнения
+static void BM_TopologicalSortKahn(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    long long m = static_cast<long long>(n) * state.range(1);
+    int threads = static_cast<int>(state.range(2));
+    TopologicalSorter sorter(CsrGraph::fromEdges(n, makeDagEdges(n, m)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(threads == 0
+            ? sorter.sort()
+            : sorter.sort(SortAlgorithm::ParallelKahn, threads));
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["threads"] = threads;
+    if (threads != 0) {
+        const auto& levels = sorter.getLevels();
+        state.counters["levels"] = levels.empty() ? 0 : *std::max_element(levels.begin(), levels.end()) + 1;
+    }
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+BENCHMARK(BM_TopologicalSortKahn)
+    ->ArgsProduct({{1 << 16, 1 << 22}, {12}, {0, 1, 8}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Поток новых зависимостей в живом DAG с корректным порядком после каждой:
+// аргументы - число вершин (средняя степень 4) и режим: 0 - полный sort(),
+// 1 - инкрементальный. items - обработанные дуги
+static void BM_IncrementalDependencies(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    bool incremental = state.range(1) != 0;
+    // Генератор может вернуть меньше рёбер, чем просили: поток - последние 256
+    auto edges = makeDagEdges(n, 4LL * n + 256);
+    std::size_t m = edges.size() - 256;
+    std::vector<std::pair<int, int>> initial(edges.begin(), edges.begin() + m);
+    // Полный пересчёт после каждой дуги дорог, поэтому его поток короче
+    std::size_t updates = incremental ? edges.size() - m : 16;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        TopologicalSorter sorter(CsrGraph::fromEdges(n, initial));
+        if (incremental) {
+            sorter.enableIncrementalMode();
+        }
+        state.ResumeTiming();
+
+        for (std::size_t i = 0; i < updates; ++i) {
+            const auto& [u, v] = edges[m + i];
+            sorter.addEdge(u + 1, v + 1);
+            benchmark::DoNotOptimize(sorter.sort());
+        }
+    }
+
+    state.counters["vertices"] = n;
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(updates));
+}
+
+BENCHMARK(BM_IncrementalDependencies)
+    ->ArgsProduct({{1 << 14, 1 << 20}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+// Канонический (лексикографически наименьший) порядок: BitsetMinQueue против
+// Кана на std::priority_queue. Аргументы - число вершин (средняя степень 2)
+// и реализация: 0 - куча, 1 - TopologicalSorter
+static void BM_TopologicalSortLexicographic(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    bool bitset = state.range(1) != 0;
+    auto edges = makeDagEdges(n, 2LL * n);
+    CsrGraph graph = CsrGraph::fromEdges(n, edges);
+    edges = {};
+    TopologicalSorter sorter(graph);
+
+    std::vector<int> in_degree(n);
+    std::vector<int> order;
+    order.reserve(n);
+    for (auto _ : state) {
+        if (bitset) {
+            benchmark::DoNotOptimize(sorter.sort(SortAlgorithm::Lexicographic));
+            continue;
+        }
+        std::fill(in_degree.begin(), in_degree.end(), 0);
+        for (int v = 0; v < n; ++v) {
+            for (int w : graph.getNeighbors(v)) {
+                in_degree[w]++;
+            }
+        }
+        std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+        for (int v = 0; v < n; ++v) {
+            if (in_degree[v] == 0) {
+                ready.push(v);
+            }
+        }
+        order.clear();
+        while (!ready.empty()) {
+            int v = ready.top();
+            ready.pop();
+            order.push_back(v);
+            for (int w : graph.getNeighbors(v)) {
+                if (--in_degree[w] == 0) {
+                    ready.push(w);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(order.data());
+    }
+
+    state.counters["vertices"] = n;
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_TopologicalSortLexicographic)
+    ->ArgsProduct({{1 << 16, 10000000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+// Разбор неудачи на графе с циклом: DAG с одной обратной дугой. Аргументы -
+// число вершин (средняя степень 4) и алгоритм: 0 - DFS, 1 - Diagnostic
+// (ещё и все компоненты), 2 - Кан с поиском цикла по оставшимся вершинам
+static void BM_TopologicalSortCycle(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    auto edges = makeDagEdges(n, 4LL * n);
+    auto [u, v] = edges[edges.size() / 2];
+    edges.push_back({v, u});
+    TopologicalSorter sorter(CsrGraph::fromEdges(n, edges));
+    edges = {};
+    SortAlgorithm algorithm[] = {SortAlgorithm::Dfs, SortAlgorithm::Diagnostic, SortAlgorithm::ParallelKahn};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sorter.sort(algorithm[state.range(1)], 1));
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["cycle_length"] = static_cast<double>(sorter.getCycle().size());
+    state.counters["components"] = static_cast<double>(sorter.getCyclicComponents().size());
+}
+
+BENCHMARK(BM_TopologicalSortCycle)
+    ->ArgsProduct({{1 << 20}, {0, 1, 2}})
+    ->Unit(benchmark::kMillisecond);
+
+// Исполнение задач DAG: аргументы - число задач (средняя степень 4), работа
+// задачи в итерациях и число потоков; threads = 0 - последовательно по
+// getOrder() для сравнения
+static void BM_DagExecutor(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    long long work = state.range(1);
+    int threads = static_cast<int>(state.range(2));
+    TopologicalSorter sorter(CsrGraph::fromEdges(n, makeDagEdges(n, 4LL * n)));
+    DagExecutor executor(sorter);
+    std::vector<std::uint64_t> results(n);
+    auto task = [&](int v) {
+        std::uint64_t x = static_cast<std::uint64_t>(v) + 1;
+        for (long long i = 0; i < work; ++i) {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        results[v] = x;
+    };
+
+    for (auto _ : state) {
+        if (threads == 0) {
+            for (int v : sorter.getOrder()) {
+                task(v);
+            }
+        } else {
+            executor.run(task, threads);
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.counters["threads"] = threads;
+    if (threads != 0) {
+        const ExecutionStats& stats = executor.getStats();
+        state.counters["achieved_parallelism"] = stats.achieved_parallelism;
+        state.counters["available_parallelism"] = stats.available_parallelism;
+        state.counters["critical_path_tasks"] = stats.critical_path_tasks;
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_DagExecutor)
+    ->ArgsProduct({{1 << 14}, {1000}, {0, 1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "graph_shapes.hpp"
+#include "johnson_algorithm.hpp"
+
+// Джонсон: Беллман - Форд плюс n запусков Дейкстры. Часть весов
+// отрицательна, но отрицательных циклов нет (рёбра DAG).
+static void runFindAllShortestPaths(benchmark::State& state, ScratchWorkspace* workspace) {
+    int n = static_cast<int>(state.range(0));
+    long long m = static_cast<long long>(n) * state.range(1);
+    auto edges = makeDagEdges(n, m);
+
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> weight(-10, 100);
+
+    JohnsonAlgorithm solver(n);
+    for (const auto& [u, v] : edges) {
+        solver.addEdge(u + 1, v + 1, weight(rng));
+    }
+
+    // С рабочей памятью ответ пишется в один переиспользуемый буфер
+    std::vector<long long> buffer;
+    for (auto _ : state) {
+        if (workspace != nullptr) {
+            benchmark::DoNotOptimize(solver.findAllShortestPaths(*workspace, buffer));
+        } else {
+            auto distances = solver.findAllShortestPaths();
+            benchmark::DoNotOptimize(distances);
+        }
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["edges"] = static_cast<double>(edges.size());
+}
+
+static void BM_FindAllShortestPaths(benchmark::State& state) {
+    runFindAllShortestPaths(state, nullptr);
+}
+
+// Рабочая память переиспользуется между итерациями
+static void BM_FindAllShortestPathsWorkspace(benchmark::State& state) {
+    ScratchWorkspace workspace;
+    runFindAllShortestPaths(state, &workspace);
+}
+
+BENCHMARK(BM_FindAllShortestPaths)
+    ->ArgsProduct({{64, 256}, {2, 8}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FindAllShortestPathsWorkspace)
+    ->ArgsProduct({{64, 256}, {2, 8}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "graph_shapes.hpp"
+#include "mst.hpp"
+
+// Остов с ограничением степени; третий аргумент - предел степени d
+static void BM_FindLimitedDegreeMST(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    Shape shape = static_cast<Shape>(state.range(1));
+    int d = static_cast<int>(state.range(2));
+    auto edges = makeUndirectedEdges(shape, n);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> weight(1, 1000);
+
+    LimitedDegreeMST solver(n, d);
+    for (const auto& [u, v] : edges) {
+        solver.addEdge(u + 1, v + 1, weight(rng));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(solver.findLimitedDegreeMST());
+    }
+
+    state.SetLabel(shapeName(shape));
+    state.counters["vertices"] = n;
+    state.counters["edges"] = static_cast<double>(edges.size());
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(edges.size()));
+}
+
+BENCHMARK(BM_FindLimitedDegreeMST)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {0, 2}, {2, 4}})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "graph_shapes.hpp"
+#include "max_flow_solver.hpp"
+
+// Диниц на слоистой сети: аргументы - число слоёв и ширина слоя.
+// Решатель хранит поток, поэтому каждую итерацию берём свежую копию.
+static void BM_FindMaxFlow(benchmark::State& state) {
+    int layers = static_cast<int>(state.range(0));
+    int width = static_cast<int>(state.range(1));
+    int n = layers * width + 2;
+    auto edges = makeLayeredNetwork(layers, width);
+
+    std::mt19937 rng(31);
+    std::uniform_int_distribution<int> capacity(1, 100);
+
+    MaxFlowSolver prototype(n);
+    for (const auto& [u, v] : edges) {
+        prototype.addEdge(u + 1, v + 1, capacity(rng));
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        MaxFlowSolver solver = prototype;
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(solver.findMaxFlow(1, n));
+    }
+
+    state.counters["vertices"] = n;
+    state.counters["edges"] = static_cast<double>(edges.size());
+}
+
+BENCHMARK(BM_FindMaxFlow)
+    ->ArgsProduct({{8, 64}, {16, 256}})
+    ->Unit(benchmark::kMicrosecond);
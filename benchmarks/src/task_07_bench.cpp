@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include "segment_tree_rmq.hpp"
+
+namespace {
+
+std::vector<int> makeArray(int n) {
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> value(-1000000, 1000000);
+    std::vector<int> array(n);
+    for (int& x : array) {
+        x = value(rng);
+    }
+    return array;
+}
+
+}  // namespace
+
+// Запросы минимума на случайных отрезках
+static void BM_RangeMinQuery(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    SegmentTreeRMQ tree(makeArray(n));
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> index(1, n);
+
+    for (auto _ : state) {
+        int l = index(rng);
+        int r = index(rng);
+        if (l > r) {
+            std::swap(l, r);
+        }
+        benchmark::DoNotOptimize(tree.rangeMinQuery(l, r));
+    }
+
+    state.counters["size"] = n;
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Точечные обновления
+static void BM_PointUpdate(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    SegmentTreeRMQ tree(makeArray(n));
+
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<int> index(1, n);
+    std::uniform_int_distribution<int> value(-1000000, 1000000);
+
+    for (auto _ : state) {
+        tree.pointUpdate(index(rng), value(rng));
+    }
+
+    state.counters["size"] = n;
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Построение дерева по массиву
+static void BM_SegmentTreeBuild(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    auto array = makeArray(n);
+
+    for (auto _ : state) {
+        SegmentTreeRMQ tree(array);
+        benchmark::DoNotOptimize(tree);
+    }
+
+    state.counters["size"] = n;
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_RangeMinQuery)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_PointUpdate)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_SegmentTreeBuild)->RangeMultiplier(16)->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
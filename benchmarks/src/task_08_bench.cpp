@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <utility>
+#include <vector>
+#include "LCASolver.hpp"
+
+namespace {
+
+// Дерево с корнем 1: path_like = 1 даёт длинную цепочку (большая глубина),
+// 0 - случайное дерево (родитель выбирается среди предыдущих вершин)
+std::vector<std::pair<int, int>> makeTree(int n, bool path_like) {
+    std::mt19937 rng(17);
+    std::vector<std::pair<int, int>> edges;
+    edges.reserve(n - 1);
+    for (int v = 2; v <= n; ++v) {
+        int parent = path_like ? v - 1 : std::uniform_int_distribution<int>(1, v - 1)(rng);
+        edges.push_back({parent, v});
+    }
+    return edges;
+}
+
+}  // namespace
+
+// Эйлеров обход и разреженная таблица
+static void BM_LCABuild(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    bool path_like = state.range(1) != 0;
+    auto edges = makeTree(n, path_like);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        LCASolver solver(n);
+        for (const auto& [u, v] : edges) {
+            solver.addEdge(u, v);
+        }
+        state.ResumeTiming();
+
+        solver.build(1);
+        benchmark::DoNotOptimize(solver);
+    }
+
+    state.SetLabel(path_like ? "path" : "random");
+    state.counters["vertices"] = n;
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_FindLCA(benchmark::State& state) {
+    int n = static_cast<int>(state.range(0));
+    bool path_like = state.range(1) != 0;
+
+    LCASolver solver(n);
+    for (const auto& [u, v] : makeTree(n, path_like)) {
+        solver.addEdge(u, v);
+    }
+    solver.build(1);
+
+    std::mt19937 rng(19);
+    std::uniform_int_distribution<int> vertex(1, n);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(solver.findLCA(vertex(rng), vertex(rng)));
+    }
+
+    state.SetLabel(path_like ? "path" : "random");
+    state.counters["vertices"] = n;
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_LCABuild)
+    ->ArgsProduct({{1 << 10, 1 << 14}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FindLCA)->ArgsProduct({{1 << 10, 1 << 14}, {0, 1}});
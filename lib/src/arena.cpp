@@ -0,0 +1,72 @@
+#include "arena.hpp"
+#include <algorithm>
+#include <cstdint>
+
+MonotonicArena::MonotonicArena(std::size_t initial_size, std::pmr::memory_resource* upstream_resource)
+    : upstream(upstream_resource), current(0), used(0), upstream_allocations(0) {
+    if (initial_size > 0) {
+        addChunk(initial_size);
+    }
+}
+
+MonotonicArena::~MonotonicArena() {
+    releaseChunks();
+}
+
+void MonotonicArena::addChunk(std::size_t size) {
+    void* data = upstream->allocate(size, kChunkAlignment);
+    ++upstream_allocations;
+    chunks.push_back({static_cast<std::byte*>(data), size});
+}
+
+void MonotonicArena::releaseChunks() {
+    for (const Chunk& chunk : chunks) {
+        upstream->deallocate(chunk.data, chunk.size, kChunkAlignment);
+    }
+    chunks.clear();
+}
+
+void* MonotonicArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    while (current < chunks.size()) {
+        const Chunk& chunk = chunks[current];
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(chunk.data);
+        std::uintptr_t start = (base + used + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+        std::size_t offset = start - base;
+
+        if (offset <= chunk.size && bytes <= chunk.size - offset) {
+            used = offset + bytes;
+            return chunk.data + offset;
+        }
+
+        if (current + 1 == chunks.size()) {
+            break;
+        }
+        ++current;
+        used = 0;
+    }
+
+    // Новый блок: не меньше запроса и вдвое больше предыдущего
+    std::size_t previous = chunks.empty() ? 0 : chunks.back().size;
+    addChunk(std::max({bytes + alignment, previous * 2, kMinChunkSize}));
+    current = chunks.size() - 1;
+    used = 0;
+    return do_allocate(bytes, alignment);
+}
+
+void MonotonicArena::reset() {
+    if (chunks.size() > 1) {
+        std::size_t total = getCapacity();
+        releaseChunks();
+        addChunk(total);
+    }
+    current = 0;
+    used = 0;
+}
+
+std::size_t MonotonicArena::getCapacity() const {
+    std::size_t total = 0;
+    for (const Chunk& chunk : chunks) {
+        total += chunk.size;
+    }
+    return total;
+}
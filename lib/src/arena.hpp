@@ -0,0 +1,77 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+// Монотонная арена для std::pmr: выделение - сдвиг указателя, освобождение
+// отдельных блоков ничего не делает. reset() возвращает арену в начало, но
+// память сохраняет: если блоков было несколько, они сливаются в один блок
+// суммарного размера. После первого «прогрева» повторные запросы того же
+// объёма не обращаются к upstream вообще.
+class MonotonicArena : public std::pmr::memory_resource {
+private:
+    struct Chunk {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t kMinChunkSize = 4096;
+    static constexpr std::size_t kChunkAlignment = alignof(std::max_align_t);
+
+    std::pmr::memory_resource* upstream;
+    std::vector<Chunk> chunks;
+    std::size_t current;        // активный блок
+    std::size_t used;           // занято байт в активном блоке
+    std::size_t upstream_allocations;
+
+    void addChunk(std::size_t size);
+    void releaseChunks();
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit MonotonicArena(std::size_t initial_size = 0,
+                            std::pmr::memory_resource* upstream_resource =
+                                std::pmr::new_delete_resource());
+    ~MonotonicArena() override;
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    // Все ранее выданные блоки становятся недействительными
+    void reset();
+
+    std::size_t getCapacity() const;
+    std::size_t getUpstreamAllocations() const { return upstream_allocations; }
+};
+
+// Рабочая память решателя, переиспользуемая между вызовами. Решатели
+// принимают её необязательным параметром: в начале вызова арена
+// сбрасывается, временные массивы берутся из неё.
+class ScratchWorkspace {
+private:
+    MonotonicArena arena;
+
+public:
+    explicit ScratchWorkspace(std::size_t initial_size = 0) : arena(initial_size) {}
+
+    std::pmr::memory_resource* getResource() { return &arena; }
+
+    void reset() { arena.reset(); }
+
+    template <typename T>
+    std::pmr::vector<T> makeVector(std::size_t size, const T& value = T()) {
+        return std::pmr::vector<T>(size, value, &arena);
+    }
+
+    std::size_t getCapacity() const { return arena.getCapacity(); }
+    std::size_t getUpstreamAllocations() const { return arena.getUpstreamAllocations(); }
+};
+
+#endif
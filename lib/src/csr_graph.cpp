@@ -0,0 +1,302 @@
+#include "csr_graph.hpp"
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+CsrGraph::CsrGraph() : vertices_count(0), owned_offsets(1, 0), external_storage(false) {
+    bindOwnedStorage();
+}
+
+CsrGraph::CsrGraph(const CsrGraph& other)
+    : vertices_count(other.vertices_count),
+      owned_offsets(other.owned_offsets),
+      owned_targets(other.owned_targets),
+      owned_weights(other.owned_weights),
+      owned_edge_ids(other.owned_edge_ids),
+      external_storage(other.external_storage),
+      mapping(other.mapping) {
+    if (external_storage) {
+        offsets = other.offsets;
+        targets = other.targets;
+        weights = other.weights;
+        edge_ids = other.edge_ids;
+    } else {
+        bindOwnedStorage();
+    }
+}
+
+CsrGraph::CsrGraph(CsrGraph&& other) noexcept
+    : vertices_count(other.vertices_count),
+      owned_offsets(std::move(other.owned_offsets)),
+      owned_targets(std::move(other.owned_targets)),
+      owned_weights(std::move(other.owned_weights)),
+      owned_edge_ids(std::move(other.owned_edge_ids)),
+      offsets(other.offsets),
+      targets(other.targets),
+      weights(other.weights),
+      edge_ids(other.edge_ids),
+      external_storage(other.external_storage),
+      mapping(std::move(other.mapping)) {
+    // Перемещение vector не меняет адрес данных, поэтому представления остаются верными
+    other.vertices_count = 0;
+    other.owned_offsets.assign(1, 0);
+    other.bindOwnedStorage();
+}
+
+CsrGraph& CsrGraph::operator=(const CsrGraph& other) {
+    if (this != &other) {
+        CsrGraph copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+CsrGraph& CsrGraph::operator=(CsrGraph&& other) noexcept {
+    if (this != &other) {
+        vertices_count = other.vertices_count;
+        owned_offsets = std::move(other.owned_offsets);
+        owned_targets = std::move(other.owned_targets);
+        owned_weights = std::move(other.owned_weights);
+        owned_edge_ids = std::move(other.owned_edge_ids);
+        offsets = other.offsets;
+        targets = other.targets;
+        weights = other.weights;
+        edge_ids = other.edge_ids;
+        external_storage = other.external_storage;
+        mapping = std::move(other.mapping);
+
+        other.vertices_count = 0;
+        other.owned_offsets.assign(1, 0);
+        other.bindOwnedStorage();
+    }
+    return *this;
+}
+
+void CsrGraph::bindOwnedStorage() {
+    external_storage = false;
+    mapping.reset();
+    offsets = owned_offsets;
+    targets = owned_targets;
+    weights = owned_weights;
+    edge_ids = owned_edge_ids;
+}
+
+void CsrGraph::makeOwned() {
+    if (!external_storage) {
+        return;
+    }
+    owned_offsets.assign(offsets.begin(), offsets.end());
+    owned_targets.assign(targets.begin(), targets.end());
+    owned_weights.assign(weights.begin(), weights.end());
+    owned_edge_ids.assign(edge_ids.begin(), edge_ids.end());
+    bindOwnedStorage();
+}
+
+CsrGraph CsrGraph::fromExternalArrays(
+    int n,
+    std::span<const long long> offsets,
+    std::span<const int> targets,
+    std::span<const long long> weights,
+    std::span<const int> edge_ids,
+    std::shared_ptr<const void> keep_alive
+) {
+    CsrGraph result;
+    result.vertices_count = n;
+    result.owned_offsets.clear();
+    result.offsets = offsets;
+    result.targets = targets;
+    result.weights = weights;
+    result.edge_ids = edge_ids;
+    result.external_storage = true;
+    result.mapping = std::move(keep_alive);
+    return result;
+}
+
+CsrGraph CsrGraph::buildImpl(
+    int n,
+    const std::vector<std::pair<int, int>>& edges,
+    const std::vector<long long>* edge_weights,
+    bool undirected,
+    bool keep_edge_ids
+) {
+    CsrGraph result;
+    result.vertices_count = n;
+    result.owned_offsets.assign(n + 1, 0);
+
+    // Первый проход: степени вершин
+    for (const auto& [u, v] : edges) {
+        result.owned_offsets[u + 1]++;
+        if (undirected) {
+            result.owned_offsets[v + 1]++;
+        }
+    }
+
+    std::partial_sum(result.owned_offsets.begin(), result.owned_offsets.end(),
+                     result.owned_offsets.begin());
+
+    long long total = result.owned_offsets[n];
+    result.owned_targets.resize(total);
+    if (edge_weights != nullptr) {
+        result.owned_weights.resize(total);
+    }
+    if (keep_edge_ids) {
+        result.owned_edge_ids.resize(total);
+    }
+
+    // Второй проход: раскладка рёбер по позициям
+    std::vector<long long> cursor(result.owned_offsets.begin(), result.owned_offsets.end() - 1);
+
+    auto place = [&](int from, int to, int id) {
+        long long pos = cursor[from]++;
+        result.owned_targets[pos] = to;
+        if (edge_weights != nullptr) {
+            result.owned_weights[pos] = (*edge_weights)[id];
+        }
+        if (keep_edge_ids) {
+            result.owned_edge_ids[pos] = id;
+        }
+    };
+
+    for (int i = 0; i < static_cast<int>(edges.size()); ++i) {
+        const auto& [u, v] = edges[i];
+        place(u, v, i);
+        if (undirected) {
+            place(v, u, i);
+        }
+    }
+
+    result.bindOwnedStorage();
+    return result;
+}
+
+CsrGraph CsrGraph::fromEdges(
+    int n,
+    const std::vector<std::pair<int, int>>& edges,
+    bool undirected,
+    bool keep_edge_ids
+) {
+    return buildImpl(n, edges, nullptr, undirected, keep_edge_ids);
+}
+
+CsrGraph CsrGraph::fromWeightedEdges(
+    int n,
+    const std::vector<std::pair<int, int>>& edges,
+    const std::vector<long long>& edge_weights,
+    bool undirected,
+    bool keep_edge_ids
+) {
+    return buildImpl(n, edges, &edge_weights, undirected, keep_edge_ids);
+}
+
+CsrGraph CsrGraph::reversed() const {
+    CsrGraph result;
+    result.vertices_count = vertices_count;
+    result.owned_offsets.assign(vertices_count + 1, 0);
+
+    for (int to : targets) {
+        result.owned_offsets[to + 1]++;
+    }
+
+    std::partial_sum(result.owned_offsets.begin(), result.owned_offsets.end(),
+                     result.owned_offsets.begin());
+
+    result.owned_targets.resize(targets.size());
+    result.owned_weights.resize(weights.size());
+    result.owned_edge_ids.resize(edge_ids.size());
+
+    std::vector<long long> cursor(result.owned_offsets.begin(), result.owned_offsets.end() - 1);
+
+    for (int u = 0; u < vertices_count; ++u) {
+        for (long long i = offsets[u]; i < offsets[u + 1]; ++i) {
+            long long pos = cursor[targets[i]]++;
+            result.owned_targets[pos] = u;
+            if (!weights.empty()) {
+                result.owned_weights[pos] = weights[i];
+            }
+            if (!edge_ids.empty()) {
+                result.owned_edge_ids[pos] = edge_ids[i];
+            }
+        }
+    }
+
+    result.bindOwnedStorage();
+    return result;
+}
+
+void CsrGraph::sortNeighbors() {
+    makeOwned();
+    
+    if (weights.empty() && edge_ids.empty()) {
+        for (int v = 0; v < vertices_count; ++v) {
+            std::sort(owned_targets.begin() + offsets[v], owned_targets.begin() + offsets[v + 1]);
+        }
+        return;
+    }
+
+    std::vector<std::tuple<int, long long, int>> row;
+    for (int v = 0; v < vertices_count; ++v) {
+        long long begin = offsets[v];
+        long long end = offsets[v + 1];
+
+        row.clear();
+        for (long long i = begin; i < end; ++i) {
+            row.emplace_back(
+                targets[i],
+                weights.empty() ? 0 : weights[i],
+                edge_ids.empty() ? 0 : edge_ids[i]
+            );
+        }
+
+        std::stable_sort(row.begin(), row.end(), [](const auto& a, const auto& b) {
+            return std::get<0>(a) < std::get<0>(b);
+        });
+
+        for (long long i = begin; i < end; ++i) {
+            const auto& [to, weight, id] = row[i - begin];
+            owned_targets[i] = to;
+            if (!weights.empty()) {
+                owned_weights[i] = weight;
+            }
+            if (!edge_ids.empty()) {
+                owned_edge_ids[i] = id;
+            }
+        }
+    }
+}
+
+std::vector<std::pair<int, int>> CsrGraph::toEdgeList(bool undirected) const {
+    std::vector<std::pair<int, int>> result;
+
+    if (!edge_ids.empty()) {
+        // Номера рёбер восстанавливают исходный порядок
+        int max_id = -1;
+        for (int id : edge_ids) {
+            max_id = std::max(max_id, id);
+        }
+        result.assign(max_id + 1, {-1, -1});
+        for (int u = 0; u < vertices_count; ++u) {
+            for (long long i = offsets[u]; i < offsets[u + 1]; ++i) {
+                if (result[edge_ids[i]].first == -1) {
+                    result[edge_ids[i]] = {u, targets[i]};
+                }
+            }
+        }
+        return result;
+    }
+
+    for (int u = 0; u < vertices_count; ++u) {
+        int self_loops = 0;
+        for (long long i = offsets[u]; i < offsets[u + 1]; ++i) {
+            int v = targets[i];
+            if (!undirected || u < v) {
+                result.push_back({u, v});
+            } else if (u == v) {
+                // Петля неориентированного графа записана в строке дважды
+                if (++self_loops % 2 == 0) {
+                    result.push_back({u, v});
+                }
+            }
+        }
+    }
+    return result;
+}
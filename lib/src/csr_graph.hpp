@@ -0,0 +1,118 @@
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Граф в формате CSR (compressed sparse row): соседи вершины v лежат
+// в targets[offsets[v] .. offsets[v + 1]). Вершины нумеруются с 0.
+//
+// Массивы либо принадлежат графу, либо указывают во внешнюю память
+// (например, в отображённый файл), которую удерживает mapping.
+// Изменяющие операции сначала копируют внешние массивы к себе.
+class CsrGraph {
+private:
+    int vertices_count;
+
+    std::vector<long long> owned_offsets;
+    std::vector<int> owned_targets;
+    std::vector<long long> owned_weights;
+    std::vector<int> owned_edge_ids;
+
+    std::span<const long long> offsets;
+    std::span<const int> targets;
+    std::span<const long long> weights;   // пусто, если граф невзвешенный
+    std::span<const int> edge_ids;        // номер исходного ребра для каждой позиции
+
+    bool external_storage;
+    std::shared_ptr<const void> mapping;
+
+    static CsrGraph buildImpl(
+        int n,
+        const std::vector<std::pair<int, int>>& edges,
+        const std::vector<long long>* edge_weights,
+        bool undirected,
+        bool keep_edge_ids
+    );
+
+    // Направляет представления на собственные массивы
+    void bindOwnedStorage();
+    // Копирует внешние массивы к себе, чтобы их можно было менять
+    void makeOwned();
+
+public:
+    CsrGraph();
+    CsrGraph(const CsrGraph& other);
+    CsrGraph(CsrGraph&& other) noexcept;
+    CsrGraph& operator=(const CsrGraph& other);
+    CsrGraph& operator=(CsrGraph&& other) noexcept;
+
+    // Построение за два прохода подсчётом: сначала степени, затем раскладка.
+    // Порядок соседей совпадает с порядком рёбер во входном списке.
+    static CsrGraph fromEdges(
+        int n,
+        const std::vector<std::pair<int, int>>& edges,
+        bool undirected = false,
+        bool keep_edge_ids = false
+    );
+
+    static CsrGraph fromWeightedEdges(
+        int n,
+        const std::vector<std::pair<int, int>>& edges,
+        const std::vector<long long>& edge_weights,
+        bool undirected = false,
+        bool keep_edge_ids = false
+    );
+
+    // Граф поверх чужих массивов без копирования; keep_alive удерживает их память
+    static CsrGraph fromExternalArrays(
+        int n,
+        std::span<const long long> offsets,
+        std::span<const int> targets,
+        std::span<const long long> weights,
+        std::span<const int> edge_ids,
+        std::shared_ptr<const void> keep_alive
+    );
+
+    // Транспонированный граф (обратный CSR) с сохранением весов и номеров рёбер
+    CsrGraph reversed() const;
+
+    // Сортировка соседей каждой вершины по возрастанию
+    void sortNeighbors();
+
+    // Исходный список рёбер; у неориентированного графа каждое ребро один раз
+    std::vector<std::pair<int, int>> toEdgeList(bool undirected = false) const;
+
+    int getVerticesCount() const { return vertices_count; }
+    long long getEdgesCount() const { return static_cast<long long>(targets.size()); }
+    bool hasWeights() const { return !weights.empty(); }
+    bool hasEdgeIds() const { return !edge_ids.empty(); }
+    bool isExternal() const { return external_storage; }
+
+    int getDegree(int v) const {
+        return static_cast<int>(offsets[v + 1] - offsets[v]);
+    }
+
+    long long getOffset(int v) const { return offsets[v]; }
+
+    std::span<const int> getNeighbors(int v) const {
+        return targets.subspan(offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    std::span<const long long> getWeights(int v) const {
+        return weights.subspan(offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    std::span<const int> getEdgeIds(int v) const {
+        return edge_ids.subspan(offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    std::span<const long long> getOffsets() const { return offsets; }
+    std::span<const int> getTargets() const { return targets; }
+    std::span<const long long> getAllWeights() const { return weights; }
+    std::span<const int> getAllEdgeIds() const { return edge_ids; }
+};
+
+#endif
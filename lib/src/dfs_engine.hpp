@@ -0,0 +1,105 @@
+#ifndef DFS_ENGINE_HPP
+#define DFS_ENGINE_HPP
+
+#include <memory_resource>
+#include <span>
+#include <vector>
+#include "csr_graph.hpp"
+
+// Кадр явного стека: вершина и позиция следующей дуги в targets.
+// Пока обрабатывается потомок, cursor указывает на древесную дугу к нему.
+struct DfsFrame {
+    int vertex;
+    long long cursor;
+};
+
+enum class DfsAction {
+    Descend,    // войти в вершину to
+    Skip,       // перейти к следующей дуге
+    Stop        // прервать обход, стек остаётся как есть
+};
+
+// Обработчик по умолчанию. Свой обработчик наследуется от него и
+// переопределяет нужные методы (вызовы статические, без virtual).
+struct DfsVisitor {
+    // С какой позиции начинать перебор дуг вершины v
+    long long firstSlot(const CsrGraph& graph, int v) { return graph.getOffset(v); }
+
+    // Вход в вершину; у корня parent == -1
+    void enter(int /*v*/, int /*parent*/) {}
+
+    // Дуга v -> to в позиции slot
+    DfsAction edge(int /*v*/, int /*parent*/, int /*to*/, long long /*slot*/) {
+        return DfsAction::Skip;
+    }
+
+    // Возврат в v из потомка child по древесной дуге slot
+    void retreat(int /*v*/, int /*child*/, long long /*slot*/) {}
+
+    // Выход из вершины (все дуги просмотрены)
+    void leave(int /*v*/, int /*parent*/) {}
+};
+
+// Итеративный DFS по CSR. Глубина ограничена только размером кучи:
+// на кадр уходит 16 байт, стек переиспользуется между запусками.
+// Порядок вызовов совпадает с обычным рекурсивным обходом.
+class DfsEngine {
+private:
+    std::pmr::vector<DfsFrame> stack;
+
+public:
+    // Стек можно разместить в арене (см. ScratchWorkspace)
+    explicit DfsEngine(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : stack(resource) {}
+
+    // Обход из root; true, если обработчик вернул Stop
+    template <typename Visitor>
+    bool run(const CsrGraph& graph, int root, Visitor& visitor) {
+        auto targets = graph.getTargets();
+
+        stack.clear();
+        visitor.enter(root, -1);
+        stack.push_back({root, visitor.firstSlot(graph, root)});
+
+        while (!stack.empty()) {
+            std::size_t top = stack.size() - 1;
+            int v = stack[top].vertex;
+            int parent = top > 0 ? stack[top - 1].vertex : -1;
+            long long end = graph.getOffset(v + 1);
+            bool descended = false;
+
+            for (long long& slot = stack[top].cursor; slot < end; ++slot) {
+                int to = targets[slot];
+                DfsAction action = visitor.edge(v, parent, to, slot);
+                if (action == DfsAction::Descend) {
+                    visitor.enter(to, v);
+                    stack.push_back({to, visitor.firstSlot(graph, to)});
+                    descended = true;
+                    break;
+                }
+                if (action == DfsAction::Stop) {
+                    return true;
+                }
+            }
+
+            if (descended) {
+                continue;
+            }
+
+            visitor.leave(v, parent);
+            stack.pop_back();
+            if (!stack.empty()) {
+                DfsFrame& frame = stack.back();
+                visitor.retreat(frame.vertex, v, frame.cursor);
+                ++frame.cursor;
+            }
+        }
+
+        return false;
+    }
+
+    // Текущий путь от корня; после Stop - путь до вершины, где обход прерван
+    std::span<const DfsFrame> getStack() const { return stack; }
+};
+
+#endif
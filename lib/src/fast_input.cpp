@@ -0,0 +1,91 @@
+#include "fast_input.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FastReader::FastReader(int descriptor)
+    : fd(descriptor),
+      owns_fd(false),
+      eof_reached(false),
+      mapped(nullptr),
+      mapped_size(0),
+      pos(nullptr),
+      end(nullptr) {
+    init();
+}
+
+FastReader::FastReader(const std::string& path)
+    : fd(::open(path.c_str(), O_RDONLY)),
+      owns_fd(true),
+      eof_reached(false),
+      mapped(nullptr),
+      mapped_size(0),
+      pos(nullptr),
+      end(nullptr) {
+    if (fd < 0) {
+        throw std::runtime_error("FastReader: cannot open " + path);
+    }
+    init();
+}
+
+FastReader::~FastReader() {
+    if (mapped != nullptr) {
+        ::munmap(const_cast<char*>(mapped), mapped_size);
+    }
+    if (owns_fd && fd >= 0) {
+        ::close(fd);
+    }
+}
+
+void FastReader::init() {
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        // Читаем с текущей позиции дескриптора: stdin мог быть частично прочитан
+        off_t offset = ::lseek(fd, 0, SEEK_CUR);
+        if (offset < 0) {
+            offset = 0;
+        }
+
+        void* region = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (region != MAP_FAILED) {
+            ::madvise(region, info.st_size, MADV_SEQUENTIAL);
+            mapped = static_cast<const char*>(region);
+            mapped_size = info.st_size;
+            pos = mapped + std::min<off_t>(offset, info.st_size);
+            end = mapped + mapped_size;
+            eof_reached = true;
+            return;
+        }
+    }
+
+    buffer.resize(kBufferSize);
+    pos = end = buffer.data();
+}
+
+bool FastReader::refill() {
+    if (eof_reached) {
+        return false;
+    }
+
+    std::size_t rest = end - pos;
+    std::memmove(buffer.data(), pos, rest);
+    pos = buffer.data();
+    end = buffer.data() + rest;
+
+    for (;;) {
+        ssize_t got = ::read(fd, buffer.data() + rest, buffer.size() - rest);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            eof_reached = true;
+            return false;
+        }
+        end += got;
+        return true;
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef FAST_INPUT_HPP
+#define FAST_INPUT_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Быстрое чтение целых чисел. Обычный файл (в том числе перенаправленный
+// stdin) отображается в память целиком через mmap, каналы и терминалы
+// читаются крупными блоками через read().
+class FastReader {
+private:
+    static constexpr std::size_t kBufferSize = 1 << 20;
+
+    int fd;
+    bool owns_fd;
+    bool eof_reached;
+
+    const char* mapped;
+    std::size_t mapped_size;
+    std::vector<char> buffer;
+
+    const char* pos;
+    const char* end;
+
+    // Догружает данные, сохраняя непрочитанный хвост; false, если вход кончился
+    bool refill();
+    void init();
+
+    // Восемь ASCII-цифр подряд (SWAR-проверка всех байт за раз)
+    static bool isEightDigits(std::uint64_t chunk) {
+        return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                 (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+                0x3333333333333333ULL);
+    }
+
+    // Перевод восьми цифр в число тремя умножениями (little-endian)
+    static std::uint64_t parseEightDigits(std::uint64_t chunk) {
+        chunk -= 0x3030303030303030ULL;
+        chunk = (chunk * 10) + (chunk >> 8);
+        chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+                 (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+        return chunk;
+    }
+
+public:
+    explicit FastReader(int descriptor = 0);
+    explicit FastReader(const std::string& path);
+    ~FastReader();
+
+    FastReader(const FastReader&) = delete;
+    FastReader& operator=(const FastReader&) = delete;
+
+    // Пропускает пробельные символы; false, если вход закончился
+    bool skipSpaces() {
+        for (;;) {
+            while (pos < end && static_cast<unsigned char>(*pos) <= ' ') {
+                ++pos;
+            }
+            if (pos < end || !refill()) {
+                return pos < end;
+            }
+        }
+    }
+
+    // Читает знаковое целое; на конце входа возвращает 0
+    template <typename T = int>
+    T readInt() {
+        if (!skipSpaces()) {
+            return 0;
+        }
+
+        bool negative = (*pos == '-');
+        pos += (negative || *pos == '+');
+
+        std::uint64_t value = 0;
+        for (;;) {
+            if constexpr (std::endian::native == std::endian::little) {
+                while (end - pos >= 8) {
+                    std::uint64_t chunk;
+                    std::memcpy(&chunk, pos, sizeof(chunk));
+                    if (!isEightDigits(chunk)) {
+                        break;
+                    }
+                    value = value * 100000000ULL + parseEightDigits(chunk);
+                    pos += 8;
+                }
+            }
+            while (pos < end && static_cast<unsigned>(*pos - '0') < 10) {
+                value = value * 10 + static_cast<unsigned>(*pos - '0');
+                ++pos;
+            }
+            // Число могло оборваться на границе буфера
+            if (pos < end || !refill()) {
+                break;
+            }
+        }
+
+        return negative ? static_cast<T>(0 - value) : static_cast<T>(value);
+    }
+
+    long long readLong() { return readInt<long long>(); }
+
+    bool isMapped() const { return mapped != nullptr; }
+};
+
+#endif
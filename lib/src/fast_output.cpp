@@ -0,0 +1,50 @@
+#include "fast_output.hpp"
+#include <cerrno>
+#include <unistd.h>
+
+const char FastWriter::kDigitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+FastWriter::FastWriter(int descriptor, FlushPolicy flush_policy, std::size_t capacity)
+    : fd(descriptor),
+      policy(flush_policy),
+      buffer(capacity < kMaxIntLength ? kMaxIntLength : capacity),
+      size(0) {}
+
+FastWriter::~FastWriter() {
+    flush();
+}
+
+void FastWriter::writeDirect(std::string_view text) {
+    const char* data = text.data();
+    std::size_t left = text.size();
+    
+    while (left > 0) {
+        ssize_t written = ::write(fd, data, left);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        left -= written;
+    }
+}
+
+void FastWriter::flush() {
+    if (size == 0) {
+        return;
+    }
+    writeDirect(std::string_view(buffer.data(), size));
+    size = 0;
+}
@@ -0,0 +1,123 @@
+#ifndef FAST_OUTPUT_HPP
+#define FAST_OUTPUT_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Буферизованный вывод целых чисел и строк напрямую через write().
+class FastWriter {
+public:
+    enum class FlushPolicy {
+        OnFull,     // сброс только при заполнении буфера и в деструкторе
+        OnNewline   // сброс после каждого перевода строки (интерактивный режим)
+    };
+
+private:
+    static constexpr std::size_t kDefaultCapacity = 1 << 20;
+    // Запас под одно число: знак и 20 цифр
+    static constexpr std::size_t kMaxIntLength = 24;
+
+    int fd;
+    FlushPolicy policy;
+    std::vector<char> buffer;
+    std::size_t size;
+
+    static const char kDigitPairs[201];
+
+    void reserve(std::size_t length) {
+        if (buffer.size() - size < length) {
+            flush();
+        }
+    }
+
+    // Записывает цифры числа справа налево по две за шаг
+    static char* formatUnsigned(unsigned long long value, char* tail) {
+        while (value >= 100) {
+            unsigned index = static_cast<unsigned>(value % 100) * 2;
+            value /= 100;
+            *--tail = kDigitPairs[index + 1];
+            *--tail = kDigitPairs[index];
+        }
+        if (value >= 10) {
+            unsigned index = static_cast<unsigned>(value) * 2;
+            *--tail = kDigitPairs[index + 1];
+            *--tail = kDigitPairs[index];
+        } else {
+            *--tail = static_cast<char>('0' + value);
+        }
+        return tail;
+    }
+
+public:
+    explicit FastWriter(int descriptor = 1,
+                        FlushPolicy flush_policy = FlushPolicy::OnFull,
+                        std::size_t capacity = kDefaultCapacity);
+    ~FastWriter();
+
+    FastWriter(const FastWriter&) = delete;
+    FastWriter& operator=(const FastWriter&) = delete;
+
+    void flush();
+
+    void writeChar(char c) {
+        reserve(1);
+        buffer[size++] = c;
+        if (c == '\n' && policy == FlushPolicy::OnNewline) {
+            flush();
+        }
+    }
+
+    void writeString(std::string_view text) {
+        if (text.size() > buffer.size() - size) {
+            flush();
+            if (text.size() > buffer.size()) {
+                writeDirect(text);
+                return;
+            }
+        }
+        std::memcpy(buffer.data() + size, text.data(), text.size());
+        size += text.size();
+        if (policy == FlushPolicy::OnNewline &&
+            text.find('\n') != std::string_view::npos) {
+            flush();
+        }
+    }
+
+    template <typename T>
+    void writeInt(T value) {
+        static_assert(std::is_integral_v<T>, "writeInt expects an integral type");
+        reserve(kMaxIntLength);
+
+        char digits[kMaxIntLength];
+        char* tail = digits + kMaxIntLength;
+        unsigned long long magnitude;
+
+        if constexpr (std::is_signed_v<T>) {
+            magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value)
+                                  : static_cast<unsigned long long>(value);
+        } else {
+            magnitude = value;
+        }
+
+        char* head = formatUnsigned(magnitude, tail);
+        if constexpr (std::is_signed_v<T>) {
+            if (value < 0) {
+                *--head = '-';
+            }
+        }
+
+        std::size_t length = tail - head;
+        std::memcpy(buffer.data() + size, head, length);
+        size += length;
+    }
+
+    // Пишет данные в обход буфера (для очень длинных строк)
+    void writeDirect(std::string_view text);
+
+    FlushPolicy getFlushPolicy() const { return policy; }
+};
+
+#endif
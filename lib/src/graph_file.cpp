@@ -0,0 +1,228 @@
+#include "graph_file.hpp"
+#include "perf_stats.hpp"
+#include <cstring>
+#include <limits>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr char kMagic[8] = {'H', 'W', 'G', 'R', 'A', 'P', 'H', '\0'};
+constexpr std::uint64_t kAlignment = 64;
+
+static_assert(sizeof(long long) == sizeof(std::int64_t), "CSR offsets must be 64-bit");
+static_assert(sizeof(int) == sizeof(std::int32_t), "CSR targets must be 32-bit");
+
+std::uint64_t alignUp(std::uint64_t value) {
+    return (value + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+bool fitsInFile(std::uint64_t position, std::uint64_t bytes, std::uint64_t file_size) {
+    return position % kAlignment == 0 && position <= file_size &&
+           bytes <= file_size - position;
+}
+
+}  // namespace
+
+bool GraphFile::isGraphFile(int fd) {
+    char magic[sizeof(kMagic)];
+    ssize_t got = ::pread(fd, magic, sizeof(magic), 0);
+    return got == static_cast<ssize_t>(sizeof(magic)) &&
+           std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+CsrGraph GraphFile::load(int fd, GraphFileHeader* header) {
+    PERF_PHASE("graph_file.load");
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        throw std::runtime_error("GraphFile: input is not a regular file");
+    }
+
+    std::uint64_t file_size = info.st_size;
+    if (file_size < sizeof(GraphFileHeader)) {
+        throw std::runtime_error("GraphFile: file is too short");
+    }
+
+    void* region = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (region == MAP_FAILED) {
+        throw std::runtime_error("GraphFile: mmap failed");
+    }
+
+    std::shared_ptr<const void> mapping(region, [file_size](const void* address) {
+        ::munmap(const_cast<void*>(address), file_size);
+    });
+
+    const char* base = static_cast<const char*>(region);
+    GraphFileHeader head;
+    std::memcpy(&head, base, sizeof(head));
+
+    if (std::memcmp(head.magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("GraphFile: bad signature");
+    }
+    if (head.version != kVersion) {
+        throw std::runtime_error("GraphFile: unsupported version");
+    }
+    if (head.endian_marker != kEndianMarker) {
+        throw std::runtime_error("GraphFile: byte order mismatch");
+    }
+    if (head.rows_count < 0 || head.rows_count > std::numeric_limits<int>::max() ||
+        head.slots_count < 0) {
+        throw std::runtime_error("GraphFile: corrupted header");
+    }
+
+    std::uint64_t rows = head.rows_count;
+    std::uint64_t slots = head.slots_count;
+    bool weighted = head.flags & Weighted;
+    bool with_ids = head.flags & WithEdgeIds;
+
+    if (!fitsInFile(head.offsets_position, (rows + 1) * sizeof(std::int64_t), file_size) ||
+        !fitsInFile(head.targets_position, slots * sizeof(std::int32_t), file_size) ||
+        (weighted && !fitsInFile(head.weights_position, slots * sizeof(std::int64_t), file_size)) ||
+        (with_ids && !fitsInFile(head.edge_ids_position, slots * sizeof(std::int32_t), file_size))) {
+        throw std::runtime_error("GraphFile: arrays exceed file size");
+    }
+
+    ::madvise(region, file_size, MADV_WILLNEED);
+
+    std::span<const long long> offsets(
+        reinterpret_cast<const long long*>(base + head.offsets_position), rows + 1);
+    std::span<const int> targets(
+        reinterpret_cast<const int*>(base + head.targets_position), slots);
+    std::span<const long long> weights;
+    std::span<const int> edge_ids;
+    if (weighted) {
+        weights = {reinterpret_cast<const long long*>(base + head.weights_position), slots};
+    }
+    if (with_ids) {
+        edge_ids = {reinterpret_cast<const int*>(base + head.edge_ids_position), slots};
+    }
+
+    // Решатели обращаются к массивам без проверок, поэтому один проход
+    // O(n + m): смещения не убывают, концы дуг - номера строк, номера рёбер
+    // не выходят за число позиций
+    if (offsets[0] != 0 || static_cast<std::uint64_t>(offsets[rows]) != slots) {
+        throw std::runtime_error("GraphFile: corrupted offsets");
+    }
+    for (std::uint64_t v = 0; v < rows; ++v) {
+        if (offsets[v] > offsets[v + 1]) {
+            throw std::runtime_error("GraphFile: corrupted offsets");
+        }
+    }
+    for (int target : targets) {
+        if (target < 0 || static_cast<std::uint64_t>(target) >= rows) {
+            throw std::runtime_error("GraphFile: corrupted targets");
+        }
+    }
+    for (int id : edge_ids) {
+        if (id < 0 || static_cast<std::uint64_t>(id) >= slots) {
+            throw std::runtime_error("GraphFile: corrupted edge ids");
+        }
+    }
+
+    if (header != nullptr) {
+        *header = head;
+    }
+
+    return CsrGraph::fromExternalArrays(
+        static_cast<int>(rows), offsets, targets, weights, edge_ids, std::move(mapping));
+}
+
+void GraphFile::requireLayout(const GraphFileHeader& header, std::uint32_t expected) {
+    if ((header.flags & kLayoutFlags) != expected) {
+        throw std::runtime_error("GraphFile: file was converted for another task");
+    }
+}
+
+CsrGraph GraphFile::load(const std::string& path, GraphFileHeader* header) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("GraphFile: cannot open " + path);
+    }
+
+    // Отображение остаётся действительным и после закрытия дескриптора
+    try {
+        CsrGraph graph = load(fd, header);
+        ::close(fd);
+        return graph;
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+void GraphFile::save(
+    const std::string& path,
+    const CsrGraph& graph,
+    std::uint32_t flags,
+    std::int64_t vertices_count,
+    std::int64_t parameter
+) {
+    GraphFileHeader head;
+    std::memset(&head, 0, sizeof(head));
+    std::memcpy(head.magic, kMagic, sizeof(kMagic));
+    head.version = kVersion;
+    head.endian_marker = kEndianMarker;
+
+    flags &= ~(Weighted | WithEdgeIds);
+    if (graph.hasWeights()) {
+        flags |= Weighted;
+    }
+    if (graph.hasEdgeIds()) {
+        flags |= WithEdgeIds;
+    }
+    head.flags = flags;
+
+    auto offsets = graph.getOffsets();
+    auto targets = graph.getTargets();
+    auto weights = graph.getAllWeights();
+    auto edge_ids = graph.getAllEdgeIds();
+
+    head.vertices_count = vertices_count;
+    head.rows_count = graph.getVerticesCount();
+    head.slots_count = graph.getEdgesCount();
+    head.parameter = parameter;
+
+    head.offsets_position = alignUp(sizeof(head));
+    head.targets_position = alignUp(head.offsets_position + offsets.size_bytes());
+    std::uint64_t end = head.targets_position + targets.size_bytes();
+    if (graph.hasWeights()) {
+        head.weights_position = alignUp(end);
+        end = head.weights_position + weights.size_bytes();
+    }
+    if (graph.hasEdgeIds()) {
+        head.edge_ids_position = alignUp(end);
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("GraphFile: cannot create " + path);
+    }
+
+    std::uint64_t written = 0;
+    auto writeAt = [&](std::uint64_t position, const void* data, std::uint64_t bytes) {
+        static const char zeros[kAlignment] = {};
+        out.write(zeros, position - written);
+        out.write(static_cast<const char*>(data), bytes);
+        written = position + bytes;
+    };
+
+    writeAt(0, &head, sizeof(head));
+    writeAt(head.offsets_position, offsets.data(), offsets.size_bytes());
+    writeAt(head.targets_position, targets.data(), targets.size_bytes());
+    if (graph.hasWeights()) {
+        writeAt(head.weights_position, weights.data(), weights.size_bytes());
+    }
+    if (graph.hasEdgeIds()) {
+        writeAt(head.edge_ids_position, edge_ids.data(), edge_ids.size_bytes());
+    }
+
+    if (!out.flush()) {
+        throw std::runtime_error("GraphFile: write failed for " + path);
+    }
+}
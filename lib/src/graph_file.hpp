@@ -0,0 +1,64 @@
+#ifndef GRAPH_FILE_HPP
+#define GRAPH_FILE_HPP
+
+#include <cstdint>
+#include <string>
+#include "csr_graph.hpp"
+
+// Заголовок бинарного файла графа. За ним идут массивы CSR, каждый
+// выровнен по 64 байта: offsets (int64, rows + 1), targets (int32),
+// weights (int64, если есть) и edge_ids (int32, если есть).
+struct GraphFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t flags;
+    std::uint32_t endian_marker;
+    std::uint32_t reserved;
+    std::int64_t vertices_count;    // n из текстового ввода
+    std::int64_t rows_count;        // число строк CSR (n или n + 1 при нумерации с 1)
+    std::int64_t slots_count;       // длина targets
+    std::int64_t parameter;         // параметр задачи (например, d в task_05)
+    std::uint64_t offsets_position;
+    std::uint64_t targets_position;
+    std::uint64_t weights_position;
+    std::uint64_t edge_ids_position;
+};
+
+class GraphFile {
+public:
+    enum Flags : std::uint32_t {
+        Undirected = 1u << 0,
+        Weighted = 1u << 1,
+        WithEdgeIds = 1u << 2,
+        OneBased = 1u << 3,     // строка 0 пустая, вершины нумеруются с 1
+        SortedNeighbors = 1u << 4
+    };
+
+    // Флаги раскладки CSR: у файла они должны совпасть с ожидаемыми решателем
+    static constexpr std::uint32_t kLayoutFlags = Undirected | Weighted | OneBased;
+
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::uint32_t kEndianMarker = 0x01020304;
+
+    // Проверяет сигнатуру, не сдвигая позицию дескриптора
+    static bool isGraphFile(int fd);
+
+    // Отображает файл в память; массивы графа указывают прямо в отображение.
+    // Повреждённые массивы - runtime_error
+    static CsrGraph load(int fd, GraphFileHeader* header = nullptr);
+    static CsrGraph load(const std::string& path, GraphFileHeader* header = nullptr);
+
+    // Бросает runtime_error, если раскладка файла не expected (например,
+    // ориентированный граф из task_03 подан в task_01)
+    static void requireLayout(const GraphFileHeader& header, std::uint32_t expected);
+
+    static void save(
+        const std::string& path,
+        const CsrGraph& graph,
+        std::uint32_t flags,
+        std::int64_t vertices_count,
+        std::int64_t parameter = 0
+    );
+};
+
+#endif
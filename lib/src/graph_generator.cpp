@@ -0,0 +1,162 @@
+#include "graph_generator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+std::vector<int> GraphGenerator::randomPermutation(int n, SeededRandom& random) {
+    std::vector<int> permutation(n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    for (int i = n - 1; i > 0; --i) {
+        std::swap(permutation[i], permutation[random.nextBelow(i + 1)]);
+    }
+    return permutation;
+}
+
+void GraphGenerator::erdosRenyi(int n, long long m, bool directed, const EdgeSink& sink) const {
+    if (n < 2 || m <= 0) {
+        return;
+    }
+
+    long long pairs = directed ? 1LL * n * (n - 1) : 1LL * n * (n - 1) / 2;
+    double p = std::min(1.0, static_cast<double>(m) / static_cast<double>(pairs));
+    double log_q = std::log1p(-p);
+    SeededRandom random(seed);
+
+    // Длина пропуска до следующего ребра распределена геометрически
+    auto skip = [&]() -> long long {
+        if (p >= 1.0) {
+            return 0;
+        }
+        double length = std::floor(std::log1p(-random.nextDouble()) / log_q);
+        return static_cast<long long>(std::min(length, static_cast<double>(pairs)));
+    };
+
+    if (directed) {
+        // Пара с номером k: u = k / (n - 1), v пробегает все вершины, кроме u
+        for (long long k = skip(); k < pairs; k += 1 + skip()) {
+            int u = static_cast<int>(k / (n - 1));
+            int v = static_cast<int>(k % (n - 1));
+            sink(u, v >= u ? v + 1 : v);
+        }
+        return;
+    }
+
+    // Пары (w, v) с w < v по строкам треугольной матрицы
+    long long v = 1;
+    long long w = -1;
+    while (v < n) {
+        w += 1 + skip();
+        while (w >= v && v < n) {
+            w -= v;
+            ++v;
+        }
+        if (v < n) {
+            sink(static_cast<int>(w), static_cast<int>(v));
+        }
+    }
+}
+
+void GraphGenerator::rmat(int scale, long long m, const EdgeSink& sink,
+                          double a, double b, double c) const {
+    int n = 1 << scale;
+    SeededRandom random(seed);
+    std::vector<int> label = randomPermutation(n, random);
+
+    for (long long i = 0; i < m; ++i) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; ++bit) {
+            double r = random.nextDouble();
+            u <<= 1;
+            v <<= 1;
+            if (r < a) {
+                // левый верхний квадрант
+            } else if (r < a + b) {
+                v |= 1;
+            } else if (r < a + b + c) {
+                u |= 1;
+            } else {
+                u |= 1;
+                v |= 1;
+            }
+        }
+        if (u != v) {
+            sink(label[u], label[v]);
+        }
+    }
+}
+
+void GraphGenerator::grid(int rows, int cols, const EdgeSink& sink) const {
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            int v = r * cols + c;
+            if (c + 1 < cols) {
+                sink(v, v + 1);
+            }
+            if (r + 1 < rows) {
+                sink(v, v + cols);
+            }
+        }
+    }
+}
+
+void GraphGenerator::path(int n, const EdgeSink& sink) const {
+    for (int v = 1; v < n; ++v) {
+        sink(v - 1, v);
+    }
+}
+
+void GraphGenerator::broom(int n, int handle, const EdgeSink& sink) const {
+    handle = std::clamp(handle, 1, std::max(n, 1));
+    for (int v = 1; v < n; ++v) {
+        sink(v < handle ? v - 1 : handle - 1, v);
+    }
+}
+
+void GraphGenerator::randomTree(int n, const EdgeSink& sink) const {
+    SeededRandom random(seed);
+    for (int v = 1; v < n; ++v) {
+        sink(static_cast<int>(random.nextBelow(v)), v);
+    }
+}
+
+void GraphGenerator::randomDag(int n, long long m, const EdgeSink& sink) const {
+    SeededRandom random(seed ^ 0xD1B54A32D192ED03ULL);
+    std::vector<int> order = randomPermutation(n, random);
+    erdosRenyi(n, m, false, [&](int u, int v) {
+        sink(order[u], order[v]);
+    });
+}
+
+void GraphGenerator::layeredNetwork(int layers, int width, int degree, const EdgeSink& sink) const {
+    if (layers <= 0 || width <= 0) {
+        return;
+    }
+
+    SeededRandom random(seed);
+    int sink_vertex = layers * width + 1;
+
+    for (int c = 0; c < width; ++c) {
+        sink(0, 1 + c);
+    }
+    for (int layer = 0; layer + 1 < layers; ++layer) {
+        for (int c = 0; c < width; ++c) {
+            int from = 1 + layer * width + c;
+            for (int k = 0; k < degree; ++k) {
+                sink(from, 1 + (layer + 1) * width + static_cast<int>(random.nextBelow(width)));
+            }
+        }
+    }
+    for (int c = 0; c < width; ++c) {
+        sink(1 + (layers - 1) * width + c, sink_vertex);
+    }
+}
+
+std::vector<std::pair<int, int>> GraphGenerator::collect(
+    const std::function<void(const EdgeSink&)>& generate) {
+    std::vector<std::pair<int, int>> edges;
+    generate([&edges](int u, int v) {
+        edges.push_back({u, v});
+    });
+    return edges;
+}
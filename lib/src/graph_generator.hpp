@@ -0,0 +1,102 @@
+#ifndef GRAPH_GENERATOR_HPP
+#define GRAPH_GENERATOR_HPP
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Генератор псевдослучайных чисел splitmix64. В отличие от
+// std::uniform_int_distribution результат не зависит от стандартной
+// библиотеки, поэтому один и тот же seed даёт одинаковый граф везде.
+class SeededRandom {
+private:
+    std::uint64_t state;
+
+public:
+    explicit SeededRandom(std::uint64_t seed) : state(seed) {}
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Равномерно в [0, bound) умножением со сдвигом (смещение < bound / 2^64)
+    std::uint64_t nextBelow(std::uint64_t bound) {
+        return static_cast<std::uint64_t>(
+            (static_cast<unsigned __int128>(next()) * bound) >> 64);
+    }
+
+    // Равномерно в [low, high]
+    long long nextInRange(long long low, long long high) {
+        return low + static_cast<long long>(
+            nextBelow(static_cast<std::uint64_t>(high - low) + 1));
+    }
+
+    // Равномерно в [0, 1)
+    double nextDouble() {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+};
+
+// Детерминированные генераторы графов для нагрузочных входов.
+//
+// Рёбра не накапливаются, а передаются в sink по одному, поэтому граф
+// на 10^8 рёбер не требует памяти под список рёбер. Каждый вызов заново
+// начинает последовательность с seed: повторный вызов с теми же
+// параметрами выдаёт те же рёбра в том же порядке (так можно сначала
+// посчитать рёбра, а потом записать их). Вершины нумеруются с 0.
+class GraphGenerator {
+public:
+    using EdgeSink = std::function<void(int from, int to)>;
+
+private:
+    std::uint64_t seed;
+
+    // Случайная перестановка 0..n-1 (Фишер - Йейтс)
+    static std::vector<int> randomPermutation(int n, SeededRandom& random);
+
+public:
+    explicit GraphGenerator(std::uint64_t generator_seed) : seed(generator_seed) {}
+
+    // G(n, p) с p, подобранным под ожидаемое число рёбер m, методом
+    // Батагели - Брандеса за O(n + m). Без петель и кратных рёбер.
+    // Неориентированные рёбра выдаются как (u, v) с u < v.
+    void erdosRenyi(int n, long long m, bool directed, const EdgeSink& sink) const;
+
+    // R-MAT (Kronecker) на 2^scale вершинах: степенное распределение
+    // степеней. Петли отбрасываются, кратные рёбра возможны. Номера
+    // вершин перемешаны, чтобы «тяжёлые» вершины не шли подряд.
+    void rmat(int scale, long long m, const EdgeSink& sink,
+              double a = 0.57, double b = 0.19, double c = 0.19) const;
+
+    // Решётка rows x cols, рёбра вправо и вниз (ориентация без циклов)
+    void grid(int rows, int cols, const EdgeSink& sink) const;
+
+    // Деревья выдаются рёбрами (parent, child) с parent < child, дети
+    // идут по возрастанию 1, 2, ..., n - 1; корень - вершина 0.
+
+    // Цепочка 0 - 1 - ... - n-1
+    void path(int n, const EdgeSink& sink) const;
+
+    // «Метла»: ручка из handle вершин, к последней прикреплены остальные листья
+    void broom(int n, int handle, const EdgeSink& sink) const;
+
+    // Случайное рекурсивное дерево: родитель вершины v равновероятен среди 0..v-1
+    void randomTree(int n, const EdgeSink& sink) const;
+
+    // Случайный DAG: G(n, p) на случайном топологическом порядке
+    void randomDag(int n, long long m, const EdgeSink& sink) const;
+
+    // Слоистая сеть: исток 0, сток layers * width + 1; каждая вершина слоя
+    // соединена с degree случайными вершинами следующего слоя
+    void layeredNetwork(int layers, int width, int degree, const EdgeSink& sink) const;
+
+    // Все рёбра в вектор (удобно для тестов и небольших графов)
+    static std::vector<std::pair<int, int>> collect(
+        const std::function<void(const EdgeSink&)>& generate);
+};
+
+#endif
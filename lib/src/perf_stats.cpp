@@ -0,0 +1,110 @@
+#include "perf_stats.hpp"
+
+#ifdef PERF_STATS_ENABLED
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+// Реестр живёт до статических деструкторов и в своём деструкторе
+// печатает отчёт в stderr
+struct Registry {
+    std::mutex mutex;
+    std::map<std::string, std::unique_ptr<PerfStats::Counter>> counters;
+    std::map<std::string, std::unique_ptr<PerfStats::Phase>> phases;
+
+    ~Registry() {
+        if (counters.empty() && phases.empty()) {
+            return;
+        }
+        std::string text = PerfStats::report();
+        text += '\n';
+        std::fputs(text.c_str(), stderr);
+    }
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+template <typename T>
+T& lookup(std::map<std::string, std::unique_ptr<T>>& entries, const char* name) {
+    auto& entry = entries[name];
+    if (!entry) {
+        entry = std::make_unique<T>();
+    }
+    return *entry;
+}
+
+void appendName(std::string& text, const std::string& name) {
+    text += '"';
+    for (char c : name) {
+        if (c == '"' || c == '\\') {
+            text += '\\';
+        }
+        text += c;
+    }
+    text += "\": ";
+}
+
+}
+
+PerfStats::Counter& PerfStats::counter(const char* name) {
+    Registry& instance = registry();
+    std::lock_guard<std::mutex> lock(instance.mutex);
+    return lookup(instance.counters, name);
+}
+
+PerfStats::Phase& PerfStats::phase(const char* name) {
+    Registry& instance = registry();
+    std::lock_guard<std::mutex> lock(instance.mutex);
+    return lookup(instance.phases, name);
+}
+
+std::string PerfStats::report() {
+    Registry& instance = registry();
+    std::lock_guard<std::mutex> lock(instance.mutex);
+
+    std::string text = "{\"counters\": {";
+    bool first = true;
+    for (const auto& [name, counter] : instance.counters) {
+        if (!first) text += ", ";
+        first = false;
+        appendName(text, name);
+        text += std::to_string(counter->value.load(std::memory_order_relaxed));
+    }
+
+    text += "}, \"phases\": {";
+    first = true;
+    for (const auto& [name, phase] : instance.phases) {
+        if (!first) text += ", ";
+        first = false;
+        appendName(text, name);
+
+        char buffer[96];
+        std::snprintf(buffer, sizeof(buffer), "{\"calls\": %lld, \"total_ms\": %.3f}",
+                      phase->calls.load(std::memory_order_relaxed),
+                      phase->nanoseconds.load(std::memory_order_relaxed) / 1e6);
+        text += buffer;
+    }
+    text += "}}";
+    return text;
+}
+
+void PerfStats::reset() {
+    Registry& instance = registry();
+    std::lock_guard<std::mutex> lock(instance.mutex);
+    for (auto& [name, counter] : instance.counters) {
+        counter->value.store(0, std::memory_order_relaxed);
+    }
+    for (auto& [name, phase] : instance.phases) {
+        phase->calls.store(0, std::memory_order_relaxed);
+        phase->nanoseconds.store(0, std::memory_order_relaxed);
+    }
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef PERF_STATS_HPP
+#define PERF_STATS_HPP
+
+// Счётчики событий и таймеры фаз для горячих участков решателей.
+// Включаются при сборке с -DPERF_STATS=ON (макрос PERF_STATS_ENABLED):
+// тогда при завершении программы в stderr печатается JSON-отчёт.
+// Без флага макросы PERF_* раскрываются в пустые операторы.
+//
+//   PERF_PHASE("johnson.dijkstra");              // время до конца блока
+//   PERF_COUNT("johnson.dijkstra.heap_pushes");  // +1
+//   PERF_COUNT_ADD("rmq.query_nodes", visited);  // +visited
+
+#ifdef PERF_STATS_ENABLED
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+class PerfStats {
+public:
+    struct Counter {
+        std::atomic<long long> value{0};
+
+        void add(long long amount) {
+            value.fetch_add(amount, std::memory_order_relaxed);
+        }
+    };
+
+    struct Phase {
+        std::atomic<long long> calls{0};
+        std::atomic<long long> nanoseconds{0};
+    };
+
+    // Замер от конструктора до деструктора
+    class ScopedPhase {
+    private:
+        Phase& phase;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit ScopedPhase(Phase& target)
+            : phase(target), start(std::chrono::steady_clock::now()) {}
+
+        ~ScopedPhase() {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            phase.calls.fetch_add(1, std::memory_order_relaxed);
+            phase.nanoseconds.fetch_add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                std::memory_order_relaxed);
+        }
+
+        ScopedPhase(const ScopedPhase&) = delete;
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+    };
+
+    // Одно имя из разных мест кода даёт один и тот же объект;
+    // ссылка действительна до конца программы
+    static Counter& counter(const char* name);
+    static Phase& phase(const char* name);
+
+    // {"counters": {...}, "phases": {"name": {"calls": c, "total_ms": t}}}
+    static std::string report();
+    // Обнуляет значения, зарегистрированные имена сохраняются
+    static void reset();
+};
+
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+
+#define PERF_COUNT_ADD(name, amount)                                       \
+    do {                                                                   \
+        static PerfStats::Counter& perf_counter = PerfStats::counter(name); \
+        perf_counter.add(amount);                                          \
+    } while (0)
+
+#define PERF_PHASE(name)                                                   \
+    static PerfStats::Phase& PERF_CONCAT(perf_phase_, __LINE__) =          \
+        PerfStats::phase(name);                                            \
+    PerfStats::ScopedPhase PERF_CONCAT(perf_scope_, __LINE__)(             \
+        PERF_CONCAT(perf_phase_, __LINE__))
+
+#else
+
+#define PERF_COUNT_ADD(name, amount) ((void)0)
+#define PERF_PHASE(name) ((void)0)
+
+#endif
+
+#define PERF_COUNT(name) PERF_COUNT_ADD(name, 1)
+
+#endif
@@ -0,0 +1,66 @@
+#include "thread_pool.hpp"
+
+ThreadPool::ThreadPool(int threads)
+    : generation(0), pending(0), stopping(false) {
+    if (threads <= 0) {
+        threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    workers.reserve(threads - 1);
+    for (int i = 1; i < threads; ++i) {
+        workers.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop(int index) {
+    unsigned long long seen = 0;
+    while (true) {
+        std::function<void(int)>* task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+            task = &job;
+        }
+
+        (*task)(index);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0) {
+            done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runOnAll(const std::function<void(int)>& fn) {
+    if (workers.empty()) {
+        fn(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = fn;
+        pending = static_cast<int>(workers.size());
+        ++generation;
+    }
+    wake.notify_all();
+
+    fn(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return pending == 0; });
+}
@@ -0,0 +1,68 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Пул из постоянных потоков для параллельных решателей. Вызывающий поток
+// тоже участвует в работе и получает номер 0, так что пул на один поток
+// не создаёт ни одного дополнительного.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::function<void(int)> job;
+    unsigned long long generation;
+    int pending;
+    bool stopping;
+
+    void workerLoop(int index);
+
+public:
+    // threads <= 0 - по числу аппаратных потоков
+    explicit ThreadPool(int threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int getThreadsCount() const { return static_cast<int>(workers.size()) + 1; }
+
+    // Выполняет fn(thread) на каждом потоке пула и ждёт завершения
+    void runOnAll(const std::function<void(int)>& fn);
+
+    // fn(begin, end, thread) для кусков [begin, end) размером не больше grain.
+    // Короткий диапазон выполняется сразу в вызывающем потоке.
+    template <typename F>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& fn) {
+        if (begin >= end) {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        if (workers.empty() || end - begin <= grain) {
+            fn(begin, end, 0);
+            return;
+        }
+
+        std::atomic<std::size_t> next(begin);
+        runOnAll([&](int thread) {
+            while (true) {
+                std::size_t from = next.fetch_add(grain, std::memory_order_relaxed);
+                if (from >= end) {
+                    break;
+                }
+                fn(from, std::min(end, from + grain), thread);
+            }
+        });
+    }
+};
+
+#endif
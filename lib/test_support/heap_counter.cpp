@@ -0,0 +1,28 @@
+#include "heap_counter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Отдельная единица трансляции: иначе пара malloc/free встраивается в
+// вызывающих и GCC видит в них несовпадающие new/delete
+
+namespace {
+
+std::atomic<long long> heap_allocations{0};
+
+}  // namespace
+
+long long getHeapAllocations() {
+    return heap_allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) {
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
@@ -0,0 +1,9 @@
+#ifndef HEAP_COUNTER_HPP
+#define HEAP_COUNTER_HPP
+
+// Число вызовов глобального operator new с начала программы. Подменённые
+// operator new/delete лежат в heap_counter.cpp: только для тестов, которые
+// проверяют отсутствие выделений в куче
+long long getHeapAllocations();
+
+#endif
@@ -2,11 +2,13 @@
 from __future__ import annotations
 
 import argparse
+import json
 import os
 import re
 from enum import Enum
 import subprocess
 import sys
+import statistics
 import time
 from dataclasses import dataclass
 from pathlib import Path
@@ -28,6 +30,10 @@ class CaseStatus(Enum):
     MEM_EXCEEDED = "mem_exceeded"
 
 
+# Output matched and time/memory were measured: these cases can be compared to a baseline
+MEASURED_STATUSES = {CaseStatus.OK, CaseStatus.SLOW, CaseStatus.MEM_EXCEEDED}
+
+
 @dataclass
 class CaseResult:
     task: str
@@ -36,6 +42,8 @@ class CaseResult:
     duration_ms: int
     message: str = ""
     peak_kb: Optional[int] = None
+    # Non-empty when slower or heavier than the baseline; independent of status
+    regression: str = ""
 
 
 def find_repo_root(start: Path) -> Path:
@@ -209,6 +217,135 @@ def run_executable_with_memory(
             pass
 
 
+def run_case(
+    exe: Path, stdin_data: str, timeout_sec: float, time_tool: Optional[str], repeat: int
+) -> Tuple[int, str, str, float, Optional[int]]:
+    """Run a case `repeat` times; report median duration and median peak RSS.
+
+    Output of the last run is returned; a timeout or non-zero exit stops early.
+    """
+    durations: List[float] = []
+    peaks: List[int] = []
+    rc, stdout, stderr = 0, "", ""
+    for _ in range(max(1, repeat)):
+        if time_tool:
+            rc, stdout, stderr, duration, peak_kb = run_executable_with_memory(
+                exe, stdin_data, timeout_sec, time_tool
+            )
+            if peak_kb is not None:
+                peaks.append(peak_kb)
+        else:
+            rc, stdout, stderr, duration = run_executable(exe, stdin_data, timeout_sec)
+        durations.append(duration)
+        if rc != 0:
+            return rc, stdout, stderr, duration, peaks[-1] if peaks else None
+    median_peak = int(statistics.median(peaks)) if peaks else None
+    return rc, stdout, stderr, statistics.median(durations), median_peak
+
+
+def case_key(task: str, case_name: str) -> str:
+    return f"{task}/{case_name}"
+
+
+def load_baseline(path: Path) -> Dict[str, Dict[str, Optional[int]]]:
+    if not path.exists():
+        return {}
+    data = json.loads(path.read_text(encoding="utf-8"))
+    return data.get("cases", {})
+
+
+def save_baseline(path: Path, results: List[CaseResult], repeat: int) -> int:
+    """Merge measured cases into the baseline file; other tasks' entries are kept."""
+    cases = load_baseline(path)
+    saved = 0
+    for r in results:
+        if r.status not in MEASURED_STATUSES:
+            continue
+        cases[case_key(r.task, r.case_name)] = {"duration_ms": r.duration_ms, "peak_kb": r.peak_kb}
+        saved += 1
+    payload = {"version": 1, "repeat": repeat, "cases": dict(sorted(cases.items()))}
+    write_text(path, json.dumps(payload, indent=2) + "\n")
+    return saved
+
+
+def exceeds(current: Optional[int], base: Optional[int], tolerance: float, slack: int) -> bool:
+    if current is None or base is None:
+        return False
+    return current > base * (1.0 + tolerance) + slack
+
+
+def format_delta(current: Optional[int], base: Optional[int]) -> str:
+    if current is None or base is None:
+        return "-"
+    if base == 0:
+        return "+0.0%" if current == 0 else "n/a"
+    return f"{(current - base) * 100.0 / base:+.1f}%"
+
+
+def check_regressions(
+    results: List[CaseResult],
+    baseline: Dict[str, Dict[str, Optional[int]]],
+    time_tolerance: float,
+    mem_tolerance: float,
+    time_slack_ms: int,
+) -> int:
+    """Record a regression on every measured case slower or heavier than the baseline.
+
+    SLOW and MEM_EXCEEDED cases are compared too: they are the worst regressions, and
+    the fixed limits alone fail the run only with --fail-on-slow/--fail-on-mem.
+    """
+    regressed = 0
+    for r in results:
+        if r.status not in MEASURED_STATUSES:
+            continue
+        base = baseline.get(case_key(r.task, r.case_name))
+        if base is None:
+            continue
+        reasons: List[str] = []
+        base_ms = base.get("duration_ms")
+        base_kb = base.get("peak_kb")
+        if exceeds(r.duration_ms, base_ms, time_tolerance, time_slack_ms):
+            reasons.append(f"time {r.duration_ms} ms vs {base_ms} ms ({format_delta(r.duration_ms, base_ms)})")
+        if exceeds(r.peak_kb, base_kb, mem_tolerance, 0):
+            reasons.append(f"mem {r.peak_kb} KB vs {base_kb} KB ({format_delta(r.peak_kb, base_kb)})")
+        if reasons:
+            r.regression = "; ".join(reasons)
+            regressed += 1
+    return regressed
+
+
+def print_task_tables(results: List[CaseResult], baseline: Dict[str, Dict[str, Optional[int]]]) -> None:
+    tasks = sorted({r.task for r in results})
+    for task in tasks:
+        rows = [("case", "status", "ms", "base ms", "time chg", "KB", "base KB", "mem chg")]
+        for r in results:
+            if r.task != task:
+                continue
+            base = baseline.get(case_key(r.task, r.case_name), {})
+            base_ms = base.get("duration_ms")
+            base_kb = base.get("peak_kb")
+            rows.append(
+                (
+                    r.case_name,
+                    r.status.value + (",regressed" if r.regression else ""),
+                    str(r.duration_ms),
+                    "-" if base_ms is None else str(base_ms),
+                    format_delta(r.duration_ms, base_ms),
+                    "-" if r.peak_kb is None else str(r.peak_kb),
+                    "-" if base_kb is None else str(base_kb),
+                    format_delta(r.peak_kb, base_kb),
+                )
+            )
+        widths = [max(len(row[i]) for row in rows) for i in range(len(rows[0]))]
+        print(f"\n--- {task} ---")
+        for index, row in enumerate(rows):
+            cells = [row[0].ljust(widths[0]), row[1].ljust(widths[1])]
+            cells += [cell.rjust(width) for cell, width in zip(row[2:], widths[2:])]
+            print("  ".join(cells))
+            if index == 0:
+                print("  ".join("-" * width for width in widths))
+
+
 def compare_outputs(actual: str, expected: str) -> bool:
     return actual == expected
 
@@ -326,8 +463,54 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
         help="On mismatch, write <case>.out.actual with the produced output",
     )
 
+    parser.add_argument(
+        "--repeat",
+        type=int,
+        default=1,
+        help="Run each case N times and use the median time and peak memory (default: 1)",
+    )
+    parser.add_argument(
+        "--baseline",
+        type=Path,
+        default=None,
+        help=(
+            "Per-case performance baseline JSON. Cases slower or heavier than the baseline "
+            "beyond the tolerances (including SLOW and MEM_EXCEEDED ones) are marked "
+            "REGRESSED and fail the run."
+        ),
+    )
+    parser.add_argument(
+        "--save-baseline",
+        action="store_true",
+        help=(
+            "Write measured cases with correct output (OK, SLOW, MEM_EXCEEDED) into --baseline "
+            "instead of comparing against it"
+        ),
+    )
+    parser.add_argument(
+        "--time-tolerance",
+        type=float,
+        default=0.10,
+        help="Allowed relative slowdown against the baseline (default: 0.10 = 10%%)",
+    )
+    parser.add_argument(
+        "--mem-tolerance",
+        type=float,
+        default=0.10,
+        help="Allowed relative peak memory growth against the baseline (default: 0.10 = 10%%)",
+    )
+    parser.add_argument(
+        "--time-slack-ms",
+        type=int,
+        default=5,
+        help="Absolute slowdown in ms always tolerated, to ignore noise on tiny cases (default: 5)",
+    )
+
     args = parser.parse_args(list(argv) if argv is not None else None)
 
+    if args.save_baseline and args.baseline is None:
+        parser.error("--save-baseline requires --baseline")
+
     script_path = Path(__file__).resolve()
     repo_root = find_repo_root(script_path)
     tests_dir = args.tests_dir or (repo_root / "tests")
@@ -378,7 +561,9 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
 
     # Decide whether to measure memory
     time_tool = find_time_tool()
-    measure_memory = bool(time_tool) and (args.mem_limit_mb is not None or args.report_memtop)
+    measure_memory = bool(time_tool) and (
+        args.mem_limit_mb is not None or args.report_memtop or args.baseline is not None
+    )
 
     for task in sorted(requested):
         exe = task_to_exe.get(task)
@@ -403,13 +588,9 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
                 continue
 
             stdin_data = read_text(input_file)
-            if measure_memory:
-                rc, stdout, stderr, duration, peak_kb = run_executable_with_memory(
-                    exe, stdin_data, args.timeout, time_tool  # type: ignore[arg-type]
-                )
-            else:
-                rc, stdout, stderr, duration = run_executable(exe, stdin_data, args.timeout)
-                peak_kb = None
+            rc, stdout, stderr, duration, peak_kb = run_case(
+                exe, stdin_data, args.timeout, time_tool if measure_memory else None, args.repeat
+            )
             duration_ms = format_ms(duration)
 
             if rc == 124:  # timeout code used above
@@ -494,6 +675,22 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
         print("\nNo cases were executed.")
         return 2
 
+    # Performance baseline: record or compare
+    baseline: Dict[str, Dict[str, Optional[int]]] = {}
+    regressed = 0
+    if args.baseline is not None:
+        if args.save_baseline:
+            saved = save_baseline(args.baseline, results, args.repeat)
+            print(f"\nSaved {saved} case(s) to baseline '{args.baseline}'")
+        baseline = load_baseline(args.baseline)
+        if not args.save_baseline:
+            if not baseline:
+                print(f"\n[WARN] Baseline '{args.baseline}' is missing or empty; nothing to compare")
+            regressed = check_regressions(
+                results, baseline, args.time_tolerance, args.mem_tolerance, args.time_slack_ms
+            )
+        print_task_tables(results, baseline)
+
     passed = sum(1 for r in results if r.status == CaseStatus.OK)
     failed = sum(1 for r in results if r.status == CaseStatus.FAIL)
     timeouts = sum(1 for r in results if r.status == CaseStatus.TIMEOUT)
@@ -505,14 +702,20 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
     print(
         f"\n=== Summary ===\n"
         f"Cases run: {passed + failed + timeouts + missing_expected + missing_exec + slow + mem_exceeded}\n"
-        f"OK: {passed}, FAIL: {failed}, TIMEOUT: {timeouts}, SLOW: {slow}, MEM_EXCEEDED: {mem_exceeded}, NO_EXPECTED: {missing_expected}, EXEC_MISSING: {missing_exec}"
+        f"OK: {passed}, FAIL: {failed}, TIMEOUT: {timeouts}, SLOW: {slow}, MEM_EXCEEDED: {mem_exceeded}, REGRESSED: {regressed}, NO_EXPECTED: {missing_expected}, EXEC_MISSING: {missing_exec}"
     )
 
+    if regressed:
+        print("\nPerformance regressions:")
+        for r in results:
+            if r.regression:
+                print(f"- {r.task}/{r.case_name} [{r.status.value}]: {r.regression}")
+
     if args.report_slowest and results:
         # Consider only cases that actually ran (exclude exec_missing/no_expected) and sort by duration
         measured = [
             r for r in results
-            if r.status in {CaseStatus.OK, CaseStatus.FAIL, CaseStatus.TIMEOUT, CaseStatus.SLOW}
+            if r.status in MEASURED_STATUSES | {CaseStatus.FAIL, CaseStatus.TIMEOUT}
         ]
         measured.sort(key=lambda r: r.duration_ms, reverse=True)
         top_n = measured[: max(0, args.report_slowest)]
@@ -537,6 +740,7 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
         or timeouts
         or missing_exec
         or missing_expected
+        or regressed
         or (args.fail_on_slow and slow)
         or (args.fail_on_mem and mem_exceeded)
     ):
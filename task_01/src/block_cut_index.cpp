@@ -0,0 +1,227 @@
+#include "block_cut_index.hpp"
+#include "dfs_engine.hpp"
+#include "perf_stats.hpp"
+#include <algorithm>
+#include <utility>
+
+BlockCutIndex::BlockCutIndex(const Graph& graph)
+    : vertices_count(graph.getVerticesCount()),
+      blocks_count(0),
+      two_edge_count(0) {
+    PERF_PHASE("critical.block_cut_index");
+    const CsrGraph& adjacency = graph.getAdjacencyList();
+    int n = vertices_count + 1;
+
+    dfs_parent.assign(n, -1);
+    tin.assign(n, -1);
+    tout.assign(n, -1);
+    low.assign(n, -1);
+    component.assign(n, -1);
+    two_edge_component.assign(n, -1);
+
+    // Блок, к которому вершина подвешена в дереве (-1 у корней DFS),
+    // и верхняя вершина каждого блока
+    std::vector<int> vertex_block(n, -1);
+    std::vector<int> block_top;
+    std::vector<int> block_stack;
+    std::vector<int> two_edge_stack;
+    int timer = 0;
+    int components_count = 0;
+
+    struct Visitor : DfsVisitor {
+        BlockCutIndex& index;
+        std::vector<int>& vertex_block;
+        std::vector<int>& block_top;
+        std::vector<int>& block_stack;
+        std::vector<int>& two_edge_stack;
+        int& timer;
+        int component_id;
+
+        void enter(int v, int parent) {
+            index.tin[v] = index.low[v] = timer++;
+            index.dfs_parent[v] = parent;
+            index.component[v] = component_id;
+            block_stack.push_back(v);
+            two_edge_stack.push_back(v);
+        }
+
+        DfsAction edge(int v, int parent, int to, long long) {
+            if (to == parent) {
+                return DfsAction::Skip;
+            }
+            if (index.tin[to] == -1) {
+                return DfsAction::Descend;
+            }
+            index.low[v] = std::min(index.low[v], index.tin[to]);
+            return DfsAction::Skip;
+        }
+
+        void retreat(int v, int child, long long) {
+            index.low[v] = std::min(index.low[v], index.low[child]);
+
+            if (index.low[child] >= index.tin[v]) {
+                // v отделяет поддерево child: новый блок с верхней вершиной v
+                int block = static_cast<int>(block_top.size());
+                block_top.push_back(v);
+                int w;
+                do {
+                    w = block_stack.back();
+                    block_stack.pop_back();
+                    vertex_block[w] = block;
+                } while (w != child);
+            }
+
+            if (index.low[child] > index.tin[v]) {
+                // (v, child) - мост: поддерево child без отрезанных ранее частей
+                int w;
+                do {
+                    w = two_edge_stack.back();
+                    two_edge_stack.pop_back();
+                    index.two_edge_component[w] = index.two_edge_count;
+                } while (w != child);
+                index.two_edge_count++;
+            }
+        }
+
+        void leave(int v, int) {
+            index.tout[v] = timer - 1;
+        }
+    };
+
+    DfsEngine engine;
+    for (int root = 1; root < n; ++root) {
+        if (tin[root] != -1) {
+            continue;
+        }
+        Visitor visitor{{}, *this, vertex_block, block_top, block_stack, two_edge_stack,
+                        timer, components_count++};
+        engine.run(adjacency, root, visitor);
+
+        // На стеках остался только корень и его компонента рёберной двусвязности
+        block_stack.clear();
+        for (int w : two_edge_stack) {
+            two_edge_component[w] = two_edge_count;
+        }
+        two_edge_stack.clear();
+        two_edge_count++;
+    }
+
+    blocks_count = static_cast<int>(block_top.size());
+
+    std::vector<std::pair<int, int>> tree_edges;
+    tree_edges.reserve(2 * blocks_count);
+    for (int v = 1; v < n; ++v) {
+        if (vertex_block[v] != -1) {
+            tree_edges.push_back({n + vertex_block[v], v});
+        }
+    }
+    for (int block = 0; block < blocks_count; ++block) {
+        tree_edges.push_back({block_top[block], n + block});
+    }
+    tree = CsrGraph::fromEdges(n + blocks_count, tree_edges);
+
+    tree_parent.assign(n + blocks_count, -1);
+    for (const auto& [parent, child] : tree_edges) {
+        tree_parent[child] = parent;
+    }
+
+    buildTreeOrder();
+}
+
+void BlockCutIndex::buildTreeOrder() {
+    int nodes = tree.getVerticesCount();
+    tree_tin.assign(nodes, -1);
+    tree_tout.assign(nodes, -1);
+    int timer = 0;
+
+    // Дети посещаются в порядке CSR, поэтому их tree_tin возрастают
+    struct Visitor : DfsVisitor {
+        BlockCutIndex& index;
+        int& timer;
+
+        void enter(int node, int) {
+            index.tree_tin[node] = timer++;
+        }
+
+        DfsAction edge(int, int, int, long long) {
+            return DfsAction::Descend;
+        }
+
+        void leave(int node, int) {
+            index.tree_tout[node] = timer - 1;
+        }
+    };
+
+    DfsEngine engine;
+    Visitor visitor{{}, *this, timer};
+    for (int node = 0; node < nodes; ++node) {
+        if (tree_parent[node] == -1) {
+            engine.run(tree, node, visitor);
+        }
+    }
+}
+
+std::vector<int> BlockCutIndex::getBlockVertices(int block) const {
+    int node = getBlockNode(block);
+    auto members = tree.getNeighbors(node);
+    std::vector<int> vertices(members.begin(), members.end());
+    vertices.push_back(tree_parent[node]);
+    std::sort(vertices.begin(), vertices.end());
+    return vertices;
+}
+
+int BlockCutIndex::childTowards(int node, int descendant) const {
+    auto children = tree.getNeighbors(node);
+    auto it = std::upper_bound(children.begin(), children.end(), tree_tin[descendant],
+                               [&](int time, int child) { return time < tree_tin[child]; });
+    return *(it - 1);
+}
+
+int BlockCutIndex::treeEdgeChild(int a, int b) const {
+    if (dfs_parent[b] == a) {
+        return b;
+    }
+    if (dfs_parent[a] == b) {
+        return a;
+    }
+    return -1;
+}
+
+bool BlockCutIndex::isArticulationPoint(int x) const {
+    // Корень DFS разделяет граф, только если под ним не меньше двух блоков
+    int child_blocks = tree.getDegree(x);
+    return tree_parent[x] == -1 ? child_blocks >= 2 : child_blocks >= 1;
+}
+
+bool BlockCutIndex::isBridge(int a, int b) const {
+    int child = treeEdgeChild(a, b);
+    return child != -1 && low[child] > tin[dfs_parent[child]];
+}
+
+bool BlockCutIndex::separatedByVertex(int u, int v, int x) const {
+    if (u == x || v == x || !connected(u, v)) {
+        return true;
+    }
+
+    // x на пути между u и v: предок ровно одного из них или их LCA
+    bool above_u = inTreeSubtree(x, u);
+    bool above_v = inTreeSubtree(x, v);
+    if (above_u != above_v) {
+        return true;
+    }
+    if (!above_u) {
+        return false;
+    }
+    return childTowards(x, u) != childTowards(x, v);
+}
+
+bool BlockCutIndex::separatedByEdge(int u, int v, int a, int b) const {
+    if (!connected(u, v)) {
+        return true;
+    }
+    if (!isBridge(a, b)) {
+        return false;
+    }
+    int child = treeEdgeChild(a, b);
+    return inDfsSubtree(child, u) != inDfsSubtree(child, v);
+}
@@ -0,0 +1,88 @@
+#ifndef BLOCK_CUT_INDEX_HPP
+#define BLOCK_CUT_INDEX_HPP
+
+#include <vector>
+#include "csr_graph.hpp"
+#include "graph.hpp"
+
+// Индекс для запросов «останутся ли u и v связаны, если откажет роутер x
+// или кабель (a, b)». Строится одним DFS за O(n + m), запрос - O(1) для
+// кабеля и O(log deg x) для роутера.
+//
+// Дерево блоков и точек сочленения: узлы 0..n - вершины графа (0 не
+// используется), узлы n + 1.. - блоки (компоненты двусвязности). Вершина
+// подвешена к блоку, в котором она не верхняя, блок - к своей верхней
+// вершине. Роутер x разделяет u и v, если узел x лежит на пути между ними.
+//
+// Кабель (a, b) разделяет u и v, только если он мост, и тогда ровно одна
+// из вершин лежит в поддереве DFS под мостом. Кратные кабели считаются
+// одним, как и в NetworkAnalyzer::findCriticalElements.
+class BlockCutIndex {
+private:
+    int vertices_count;
+    int blocks_count;
+    int two_edge_count;
+
+    // DFS по исходному графу: поддерево v - вершины с tin в [tin[v], tout[v]]
+    std::vector<int> dfs_parent;
+    std::vector<int> tin;
+    std::vector<int> tout;
+    std::vector<int> low;
+    std::vector<int> component;
+    std::vector<int> two_edge_component;
+
+    // Дерево блоков: дуги от родителя к детям, дети идут по возрастанию tree_tin
+    CsrGraph tree;
+    std::vector<int> tree_parent;
+    std::vector<int> tree_tin;
+    std::vector<int> tree_tout;
+
+    bool inDfsSubtree(int root, int v) const {
+        return tin[root] <= tin[v] && tin[v] <= tout[root];
+    }
+
+    bool inTreeSubtree(int root, int node) const {
+        return tree_tin[root] <= tree_tin[node] && tree_tin[node] <= tree_tout[root];
+    }
+
+    // Ребёнок узла node, в поддереве которого лежит descendant
+    int childTowards(int node, int descendant) const;
+
+    // Нижний конец древесного ребра (a, b) или -1, если это не ребро дерева DFS
+    int treeEdgeChild(int a, int b) const;
+
+    // tree_tin/tree_tout обходом дерева блоков
+    void buildTreeOrder();
+
+public:
+    explicit BlockCutIndex(const Graph& graph);
+
+    int getVerticesCount() const { return vertices_count; }
+    int getBlocksCount() const { return blocks_count; }
+    int getTwoEdgeComponentsCount() const { return two_edge_count; }
+
+    // Дерево блоков (см. выше) и номер узла блока с индексом block
+    const CsrGraph& getTree() const { return tree; }
+    int getBlockNode(int block) const { return vertices_count + 1 + block; }
+    // Вершины блока по возрастанию
+    std::vector<int> getBlockVertices(int block) const;
+
+    // Номер компоненты рёберной двусвязности вершины v
+    int getTwoEdgeComponent(int v) const { return two_edge_component[v]; }
+
+    bool isArticulationPoint(int x) const;
+    bool isBridge(int a, int b) const;
+
+    bool connected(int u, int v) const { return component[u] == component[v]; }
+    bool twoEdgeConnected(int u, int v) const {
+        return two_edge_component[u] == two_edge_component[v];
+    }
+
+    // true, если u и v не связаны после отказа роутера x.
+    // Отказ самого u или v тоже считается разделением.
+    bool separatedByVertex(int u, int v, int x) const;
+    // true, если u и v не связаны после обрыва кабеля (a, b)
+    bool separatedByEdge(int u, int v, int a, int b) const;
+};
+
+#endif
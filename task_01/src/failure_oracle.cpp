@@ -0,0 +1,282 @@
+#include "failure_oracle.hpp"
+#include "dfs_engine.hpp"
+#include "graph_generator.hpp"
+#include "perf_stats.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <bit>
+
+FailureOracle::FailureOracle(const Graph& source, std::uint64_t seed)
+    : vertices_count(source.getVerticesCount()),
+      components_count(0) {
+    PERF_PHASE("failures.build");
+    int n = vertices_count + 1;
+
+    edge_ends = source.getAdjacencyList().toEdgeList(true);
+    for (auto& [u, v] : edge_ends) {
+        if (u > v) {
+            std::swap(u, v);
+        }
+    }
+    std::erase_if(edge_ends, [](const std::pair<int, int>& edge) {
+        return edge.first == edge.second;
+    });
+    std::sort(edge_ends.begin(), edge_ends.end());
+    edge_ends.erase(std::unique(edge_ends.begin(), edge_ends.end()), edge_ends.end());
+
+    graph = CsrGraph::fromEdges(n, edge_ends, true, true);
+    graph.sortNeighbors();
+
+    SeededRandom random(seed);
+    edge_label.resize(edge_ends.size());
+    for (std::uint64_t& label : edge_label) {
+        label = random.next();
+    }
+
+    dfs_parent.assign(n, -1);
+    tree_root.assign(n, -1);
+    tin.assign(n, -1);
+    tout.assign(n, -1);
+    subtree_xor.assign(n, 0);
+    for (std::size_t id = 0; id < edge_ends.size(); ++id) {
+        subtree_xor[edge_ends[id].first] ^= edge_label[id];
+        subtree_xor[edge_ends[id].second] ^= edge_label[id];
+    }
+
+    int timer = 0;
+    struct Visitor : DfsVisitor {
+        FailureOracle& oracle;
+        int& timer;
+        int root;
+
+        void enter(int v, int parent) {
+            oracle.tin[v] = timer++;
+            oracle.dfs_parent[v] = parent;
+            oracle.tree_root[v] = root;
+        }
+
+        DfsAction edge(int, int, int to, long long) {
+            return oracle.tin[to] == -1 ? DfsAction::Descend : DfsAction::Skip;
+        }
+
+        void retreat(int v, int child, long long) {
+            oracle.subtree_xor[v] ^= oracle.subtree_xor[child];
+        }
+
+        void leave(int v, int) {
+            oracle.tout[v] = timer - 1;
+        }
+    };
+
+    DfsEngine engine;
+    for (int root = 1; root < n; ++root) {
+        if (tin[root] == -1) {
+            Visitor visitor{{}, *this, timer, root};
+            engine.run(graph, root, visitor);
+            components_count++;
+        }
+    }
+}
+
+int FailureOracle::findEdge(int a, int b) const {
+    if (a < 1 || a > vertices_count || b < 1 || b > vertices_count) {
+        return -1;
+    }
+    auto neighbors = graph.getNeighbors(a);
+    auto it = std::lower_bound(neighbors.begin(), neighbors.end(), b);
+    if (it == neighbors.end() || *it != b) {
+        return -1;
+    }
+    return graph.getEdgeIds(a)[it - neighbors.begin()];
+}
+
+int FailureOracle::findPiece(const Scratch& scratch, int v) const {
+    // Ближайший кусок слева по tin; если v не в нём - поднимаемся к объемлющим
+    int index = static_cast<int>(std::upper_bound(scratch.root_tin.begin(),
+                                                  scratch.root_tin.end(), tin[v]) -
+                                 scratch.root_tin.begin()) - 1;
+    while (!inSubtree(scratch.roots[index], v)) {
+        index = scratch.enclosing[index];
+    }
+    return index;
+}
+
+int FailureOracle::evaluate(const FailureScenario& scenario, Scratch& scratch) const {
+    std::vector<int>& routers = scratch.routers;
+    routers.clear();
+    for (int x : scenario.routers) {
+        if (x >= 1 && x <= vertices_count) {
+            routers.push_back(x);
+        }
+    }
+    std::sort(routers.begin(), routers.end());
+    routers.erase(std::unique(routers.begin(), routers.end()), routers.end());
+    auto failed = [&](int v) {
+        return std::binary_search(routers.begin(), routers.end(), v);
+    };
+
+    // Кабели у отказавших роутеров и так пропадают вместе с ними
+    std::vector<int>& removed_edges = scratch.removed_edges;
+    removed_edges.clear();
+    for (const auto& [a, b] : scenario.cables) {
+        int id = findEdge(a, b);
+        if (id != -1 && !failed(a) && !failed(b)) {
+            removed_edges.push_back(id);
+        }
+    }
+    std::sort(removed_edges.begin(), removed_edges.end());
+    removed_edges.erase(std::unique(removed_edges.begin(), removed_edges.end()),
+                        removed_edges.end());
+
+    // Верхние вершины кусков: корни задетых деревьев, отказавшие роутеры
+    // и их дети, нижние концы оборванных рёбер леса
+    std::vector<int>& roots = scratch.roots;
+    roots.clear();
+    for (int x : routers) {
+        roots.push_back(tree_root[x]);
+        roots.push_back(x);
+        for (int y : graph.getNeighbors(x)) {
+            if (dfs_parent[y] == x) {
+                roots.push_back(y);
+            }
+        }
+    }
+    for (int id : removed_edges) {
+        auto [a, b] = edge_ends[id];
+        roots.push_back(tree_root[a]);
+        if (dfs_parent[b] == a) {
+            roots.push_back(b);
+        } else if (dfs_parent[a] == b) {
+            roots.push_back(a);
+        }
+    }
+    if (roots.empty()) {
+        return components_count;
+    }
+    std::sort(roots.begin(), roots.end(), [&](int a, int b) { return tin[a] < tin[b]; });
+    roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+    if (roots.size() > kMaxPieces) {
+        PERF_COUNT("failures.traversals");
+        return countByTraversal(scratch);
+    }
+
+    // Кусок - поддерево своей вершины без поддеревьев вложенных кусков
+    std::size_t pieces = roots.size();
+    scratch.root_tin.resize(pieces);
+    scratch.enclosing.assign(pieces, -1);
+    scratch.labels.resize(pieces);
+    scratch.dead.assign(pieces, 0);
+    int affected_trees = 0;
+    for (std::size_t i = 0; i < pieces; ++i) {
+        int r = roots[i];
+        scratch.root_tin[i] = tin[r];
+        scratch.labels[i] = subtree_xor[r];
+        scratch.dead[i] = failed(r);
+        if (tree_root[r] == r) {
+            affected_trees++;
+            continue;
+        }
+        int outer = static_cast<int>(i) - 1;
+        while (!inSubtree(roots[outer], r)) {
+            outer = scratch.enclosing[outer];
+        }
+        scratch.enclosing[i] = outer;
+        scratch.labels[outer] ^= subtree_xor[r];
+    }
+
+    // Удалённые рёбра больше не выходят из кусков
+    for (int x : routers) {
+        auto neighbors = graph.getNeighbors(x);
+        auto ids = graph.getEdgeIds(x);
+        for (std::size_t slot = 0; slot < neighbors.size(); ++slot) {
+            if (!failed(neighbors[slot])) {
+                scratch.labels[findPiece(scratch, neighbors[slot])] ^= edge_label[ids[slot]];
+            }
+        }
+    }
+    for (int id : removed_edges) {
+        scratch.labels[findPiece(scratch, edge_ends[id].first)] ^= edge_label[id];
+        scratch.labels[findPiece(scratch, edge_ends[id].second)] ^= edge_label[id];
+    }
+
+    // Ранг меток живых кусков над GF(2): базис по старшему биту
+    std::uint64_t basis[64] = {};
+    int live = 0;
+    int rank = 0;
+    for (std::size_t i = 0; i < pieces; ++i) {
+        if (scratch.dead[i]) {
+            continue;
+        }
+        live++;
+        std::uint64_t label = scratch.labels[i];
+        while (label != 0) {
+            int bit = 63 - std::countl_zero(label);
+            if (basis[bit] == 0) {
+                basis[bit] = label;
+                rank++;
+                break;
+            }
+            label ^= basis[bit];
+        }
+    }
+
+    return components_count - affected_trees + live - rank;
+}
+
+int FailureOracle::countByTraversal(Scratch& scratch) const {
+    // routers и removed_edges уже отсортированы в evaluate
+    const std::vector<int>& routers = scratch.routers;
+    const std::vector<int>& removed_edges = scratch.removed_edges;
+    if (scratch.visited.empty()) {
+        scratch.visited.assign(vertices_count + 1, 0);
+    }
+    unsigned stamp = ++scratch.stamp;
+    for (int x : routers) {
+        scratch.visited[x] = stamp;
+    }
+
+    int components = 0;
+    for (int start = 1; start <= vertices_count; ++start) {
+        if (scratch.visited[start] == stamp) {
+            continue;
+        }
+        components++;
+        scratch.visited[start] = stamp;
+        scratch.queue.assign(1, start);
+        for (std::size_t i = 0; i < scratch.queue.size(); ++i) {
+            int v = scratch.queue[i];
+            auto neighbors = graph.getNeighbors(v);
+            auto ids = graph.getEdgeIds(v);
+            for (std::size_t slot = 0; slot < neighbors.size(); ++slot) {
+                int to = neighbors[slot];
+                if (scratch.visited[to] != stamp &&
+                    !std::binary_search(removed_edges.begin(), removed_edges.end(), ids[slot])) {
+                    scratch.visited[to] = stamp;
+                    scratch.queue.push_back(to);
+                }
+            }
+        }
+    }
+    return components;
+}
+
+int FailureOracle::countComponents(const FailureScenario& scenario) const {
+    Scratch scratch;
+    return evaluate(scenario, scratch);
+}
+
+std::vector<int> FailureOracle::countComponentsBatch(
+    const std::vector<FailureScenario>& scenarios,
+    int threads
+) const {
+    PERF_PHASE("failures.batch");
+    ThreadPool pool(threads);
+    std::vector<Scratch> scratch(pool.getThreadsCount());
+    std::vector<int> result(scenarios.size());
+    pool.parallelFor(0, scenarios.size(), 64, [&](std::size_t from, std::size_t to, int thread) {
+        for (std::size_t i = from; i < to; ++i) {
+            result[i] = evaluate(scenarios[i], scratch[thread]);
+        }
+    });
+    return result;
+}
@@ -0,0 +1,96 @@
+#ifndef FAILURE_ORACLE_HPP
+#define FAILURE_ORACLE_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "csr_graph.hpp"
+#include "graph.hpp"
+
+// Сценарий отказа: вышедшие из строя роутеры и оборванные кабели
+struct FailureScenario {
+    std::vector<int> routers;
+    std::vector<std::pair<int, int>> cables;
+};
+
+// Число компонент связности после отказа нескольких роутеров и кабелей без
+// пересборки графа. Строится один раз за O(n + m), сценарий из k отказов
+// считается за O(k log k + сумма степеней отказавших роутеров).
+//
+// Каждому ребру назначается случайная 64-битная метка, метка вершины - xor
+// меток её рёбер, по остовному лесу DFS копятся xor поддеревьев. Отказы
+// режут лес на куски-отрезки прямого порядка; метка куска - xor рёбер,
+// выходящих из него, после вычитания удалённых. Набор кусков без рёбер
+// наружу - объединение компонент, и такие наборы - ядро отображения в
+// метки над GF(2), так что компонент среди кусков столько, сколько кусков
+// минус ранг их меток. Ошибка возможна лишь при случайном вырождении меток,
+// вероятность ~2^-32; при кусках больше kMaxPieces сценарий считается
+// обходом графа.
+//
+// Кратные кабели считаются одним, как и в NetworkAnalyzer::findCriticalElements:
+// обрыв кабеля (a, b) удаляет все его копии.
+class FailureOracle {
+private:
+    static constexpr std::size_t kMaxPieces = 32;
+
+    // Рабочая память одного потока
+    struct Scratch {
+        std::vector<int> routers;
+        std::vector<int> removed_edges;
+        std::vector<int> roots;
+        std::vector<int> root_tin;
+        std::vector<int> enclosing;
+        std::vector<std::uint64_t> labels;
+        std::vector<char> dead;
+
+        // Для обхода
+        std::vector<unsigned> visited;
+        unsigned stamp = 0;
+        std::vector<int> queue;
+    };
+
+    int vertices_count;
+    int components_count;
+
+    // Граф без петель и кратных рёбер; edge_ids указывают в edge_ends и edge_label
+    CsrGraph graph;
+    std::vector<std::pair<int, int>> edge_ends;
+    std::vector<std::uint64_t> edge_label;
+
+    // Лес DFS: поддерево v - вершины с tin в [tin[v], tout[v]]
+    std::vector<int> dfs_parent;
+    std::vector<int> tree_root;
+    std::vector<int> tin;
+    std::vector<int> tout;
+    std::vector<std::uint64_t> subtree_xor;
+
+    bool inSubtree(int root, int v) const {
+        return tin[root] <= tin[v] && tin[v] <= tout[root];
+    }
+
+    // Номер ребра (a, b) или -1
+    int findEdge(int a, int b) const;
+
+    // Индекс куска с вершиной v среди scratch.roots
+    int findPiece(const Scratch& scratch, int v) const;
+
+    int evaluate(const FailureScenario& scenario, Scratch& scratch) const;
+    int countByTraversal(Scratch& scratch) const;
+
+public:
+    explicit FailureOracle(const Graph& graph, std::uint64_t seed = 0x5EEDF00DULL);
+
+    int getComponentsCount() const { return components_count; }
+
+    // Компоненты среди оставшихся роутеров после отказов сценария.
+    // Несуществующие кабели и повторы игнорируются
+    int countComponents(const FailureScenario& scenario) const;
+
+    // Независимые сценарии на threads потоках (threads <= 0 - по числу ядер)
+    std::vector<int> countComponentsBatch(
+        const std::vector<FailureScenario>& scenarios,
+        int threads = 1
+    ) const;
+};
+
+#endif
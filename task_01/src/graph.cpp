@@ -1,29 +1,51 @@
 #include "graph.hpp"
-#include <algorithm>
+#include <utility>
 
-Graph::Graph(int n) : vertices_count(n) {
-    adjacency_list.resize(n + 1);
-}
+Graph::Graph(int n) 
+    : vertices_count(n),
+      adjacency_dirty(true),
+      sorted_neighbors(false) {}
+
+Graph::Graph(CsrGraph adjacency)
+    : vertices_count(adjacency.getVerticesCount() - 1),
+      adjacency_list(std::move(adjacency)),
+      adjacency_dirty(false),
+      sorted_neighbors(false) {}
 
 void Graph::addEdge(int u, int v) {
-    adjacency_list[u].push_back(v);
-    adjacency_list[v].push_back(u);
+    if (!adjacency_dirty && edges.empty()) {
+        // Граф задан готовым CSR: восстанавливаем список рёбер перед изменением
+        edges = adjacency_list.toEdgeList(true);
+    }
+    edges.push_back({u, v});
+    adjacency_dirty = true;
 }
 
-const std::vector<int>& Graph::getNeighbors(int v) const {
-    return adjacency_list[v];
+std::span<const int> Graph::getNeighbors(int v) const {
+    return getAdjacencyList().getNeighbors(v);
 }
 
 int Graph::getVerticesCount() const {
     return vertices_count;
 }
 
-const std::vector<std::vector<int>>& Graph::getAdjacencyList() const {
+const CsrGraph& Graph::getAdjacencyList() const {
+    if (adjacency_dirty) {
+        // Вершины нумеруются с 1, поэтому в CSR на одну вершину больше
+        adjacency_list = CsrGraph::fromEdges(vertices_count + 1, edges, true);
+        if (sorted_neighbors) {
+            adjacency_list.sortNeighbors();
+        }
+        adjacency_dirty = false;
+    }
     return adjacency_list;
 }
 
 void Graph::sortAdjacencyLists() {
-    for (int i = 1; i <= vertices_count; ++i) {
-        std::sort(adjacency_list[i].begin(), adjacency_list[i].end());
+    sorted_neighbors = true;
+    if (!adjacency_dirty && edges.empty()) {
+        adjacency_list.sortNeighbors();
+    } else {
+        adjacency_dirty = true;
     }
-}
\ No newline at end of file
+}
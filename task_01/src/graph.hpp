@@ -2,28 +2,32 @@
 #define GRAPH_HPP
 
 #include <vector>
-
-enum class Color {
-    White,
-    Gray,
-    Black
-};
+#include <span>
+#include <utility>
+#include "csr_graph.hpp"
 
 class Graph {
 protected:
     int vertices_count;
-    std::vector<std::vector<int>> adjacency_list;
+    std::vector<std::pair<int, int>> edges;
+    
+    // CSR строится лениво по списку рёбер при первом обращении
+    mutable CsrGraph adjacency_list;
+    mutable bool adjacency_dirty;
+    bool sorted_neighbors;
     
 public:
     Graph(int n);
+    // Готовый CSR (например, из бинарного файла); строк n + 1, строка 0 пустая
+    explicit Graph(CsrGraph adjacency);
     virtual ~Graph() = default;
     
     void addEdge(int u, int v);
-    const std::vector<int>& getNeighbors(int v) const;
+    std::span<const int> getNeighbors(int v) const;
     int getVerticesCount() const;
-    const std::vector<std::vector<int>>& getAdjacencyList() const;
+    const CsrGraph& getAdjacencyList() const;
     
     void sortAdjacencyLists();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,235 @@
+#include "incremental_biconnectivity.hpp"
+#include <algorithm>
+
+IncrementalBiconnectivity::IncrementalBiconnectivity(int n)
+    : vertices_count(n),
+      parent(n + 1, -1),
+      parent_edge(n + 1, -1),
+      tree(n + 1),
+      component_link(n + 1),
+      component_size(n + 1, 1),
+      block_degree(n + 1, 0),
+      bridges_count(0),
+      articulation_count(0),
+      stamp(0),
+      mark_first(n + 1, 0),
+      mark_second(n + 1, 0) {
+    for (int v = 0; v <= n; ++v) {
+        component_link[v] = v;
+    }
+    block_link.reserve(n);
+    block_edges.reserve(n);
+    block_top.reserve(n);
+    top_stamp.reserve(n);
+}
+
+int IncrementalBiconnectivity::findComponent(int v) const {
+    while (component_link[v] != v) {
+        component_link[v] = component_link[component_link[v]];
+        v = component_link[v];
+    }
+    return v;
+}
+
+int IncrementalBiconnectivity::findBlock(int edge) const {
+    while (block_link[edge] != edge) {
+        block_link[edge] = block_link[block_link[edge]];
+        edge = block_link[edge];
+    }
+    return edge;
+}
+
+int IncrementalBiconnectivity::uniteBlocks(int a, int b) {
+    if (block_edges[a] < block_edges[b]) {
+        std::swap(a, b);
+    }
+    block_link[b] = a;
+    block_edges[a] += block_edges[b];
+    return a;
+}
+
+void IncrementalBiconnectivity::changeBlockDegree(int v, int delta) {
+    bool was = block_degree[v] >= 2;
+    block_degree[v] += delta;
+    bool now = block_degree[v] >= 2;
+    articulation_count += static_cast<int>(now) - static_cast<int>(was);
+}
+
+void IncrementalBiconnectivity::reroot(int s) {
+    if (parent[s] == -1) {
+        return;
+    }
+
+    // Обход в ширину от s: у каждого блока первым встретится ребро,
+    // выходящее из его новой верхней вершины
+    ++stamp;
+    parent[s] = -1;
+    parent_edge[s] = -1;
+    queue.assign(1, s);
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        int x = queue[i];
+        for (const TreeArc& arc : tree[x]) {
+            if (arc.edge == parent_edge[x]) {
+                continue;
+            }
+            parent[arc.to] = x;
+            parent_edge[arc.to] = arc.edge;
+            int block = findBlock(arc.edge);
+            if (top_stamp[block] != stamp) {
+                top_stamp[block] = stamp;
+                block_top[block] = x;
+            }
+            queue.push_back(arc.to);
+        }
+    }
+}
+
+void IncrementalBiconnectivity::linkTrees(int u, int v) {
+    int root_u = findComponent(u);
+    int root_v = findComponent(v);
+    // Переподвешиваем меньшее дерево (оно на стороне v)
+    if (component_size[root_u] < component_size[root_v]) {
+        std::swap(u, v);
+        std::swap(root_u, root_v);
+    }
+    reroot(v);
+
+    int edge = static_cast<int>(block_link.size());
+    block_link.push_back(edge);
+    block_edges.push_back(1);
+    block_top.push_back(u);
+    top_stamp.push_back(0);
+
+    parent[v] = u;
+    parent_edge[v] = edge;
+    tree[u].push_back({v, edge});
+    tree[v].push_back({u, edge});
+
+    component_link[root_v] = root_u;
+    component_size[root_u] += component_size[root_v];
+
+    bridges_count++;
+    changeBlockDegree(u, 1);
+    changeBlockDegree(v, 1);
+}
+
+void IncrementalBiconnectivity::closeCycle(int u, int v) {
+    // Поднимаемся от u и v по очереди, пока один не наступит на след другого
+    ++stamp;
+    path_first.assign(1, u);
+    path_second.assign(1, v);
+    mark_first[u] = stamp;
+    mark_second[v] = stamp;
+
+    int meet = -1;
+    int a = u;
+    int b = v;
+    while (meet == -1) {
+        if (parent[a] != -1) {
+            a = jumpUp(a);
+            path_first.push_back(a);
+            mark_first[a] = stamp;
+        }
+        if (mark_second[a] == stamp) {
+            meet = a;
+            break;
+        }
+        if (parent[b] != -1) {
+            b = jumpUp(b);
+            path_second.push_back(b);
+            mark_second[b] = stamp;
+        }
+        if (mark_first[b] == stamp) {
+            meet = b;
+        }
+    }
+
+    // Одна из цепочек могла уйти выше точки встречи
+    path_first.resize(std::find(path_first.begin(), path_first.end(), meet) - path_first.begin() + 1);
+    path_second.resize(std::find(path_second.begin(), path_second.end(), meet) - path_second.begin() + 1);
+
+    // Вершины внутри цепочек соединяли два разных блока, теперь один
+    for (const std::vector<int>* path : {&path_first, &path_second}) {
+        for (std::size_t i = 1; i + 1 < path->size(); ++i) {
+            changeBlockDegree((*path)[i], -1);
+        }
+    }
+    if (path_first.size() > 1 && path_second.size() > 1) {
+        int last_first = findBlock(parent_edge[path_first[path_first.size() - 2]]);
+        int last_second = findBlock(parent_edge[path_second[path_second.size() - 2]]);
+        if (last_first != last_second) {
+            changeBlockDegree(meet, -1);
+        }
+    }
+
+    int merged = -1;
+    int single_edge_blocks = 0;
+    for (const std::vector<int>* path : {&path_first, &path_second}) {
+        for (std::size_t i = 0; i + 1 < path->size(); ++i) {
+            int block = findBlock(parent_edge[(*path)[i]]);
+            if (block == merged) {
+                continue;
+            }
+            if (block_edges[block] == 1) {
+                single_edge_blocks++;
+            }
+            merged = merged == -1 ? block : uniteBlocks(merged, block);
+        }
+    }
+    block_top[merged] = meet;
+    bridges_count -= single_edge_blocks;
+}
+
+void IncrementalBiconnectivity::addEdge(int u, int v) {
+    if (u == v) {
+        return;
+    }
+    if (findComponent(u) != findComponent(v)) {
+        linkTrees(u, v);
+        return;
+    }
+    // Повтор ребра леса не образует нового цикла
+    if (parent[u] == v || parent[v] == u) {
+        return;
+    }
+    closeCycle(u, v);
+}
+
+bool IncrementalBiconnectivity::connected(int u, int v) const {
+    return findComponent(u) == findComponent(v);
+}
+
+bool IncrementalBiconnectivity::isBridge(int u, int v) const {
+    int edge;
+    if (parent[u] == v) {
+        edge = parent_edge[u];
+    } else if (parent[v] == u) {
+        edge = parent_edge[v];
+    } else {
+        return false;
+    }
+    return block_edges[findBlock(edge)] == 1;
+}
+
+std::vector<int> IncrementalBiconnectivity::getArticulationPoints() const {
+    std::vector<int> points;
+    points.reserve(articulation_count);
+    for (int v = 1; v <= vertices_count; ++v) {
+        if (isArticulationPoint(v)) {
+            points.push_back(v);
+        }
+    }
+    return points;
+}
+
+std::vector<std::pair<int, int>> IncrementalBiconnectivity::getBridges() const {
+    std::vector<std::pair<int, int>> bridges;
+    bridges.reserve(bridges_count);
+    for (int v = 1; v <= vertices_count; ++v) {
+        if (parent[v] != -1 && block_edges[findBlock(parent_edge[v])] == 1) {
+            bridges.push_back({std::min(v, parent[v]), std::max(v, parent[v])});
+        }
+    }
+    std::sort(bridges.begin(), bridges.end());
+    return bridges;
+}
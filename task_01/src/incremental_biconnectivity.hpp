@@ -0,0 +1,91 @@
+#ifndef INCREMENTAL_BICONNECTIVITY_HPP
+#define INCREMENTAL_BICONNECTIVITY_HPP
+
+#include <utility>
+#include <vector>
+
+// Мосты и точки сочленения при добавлении рёбер, без пересчёта с нуля.
+//
+// Поддерживается остовный лес. Ребро между разными деревьями становится
+// рёбром леса: меньшее дерево переподвешивается за свой конец (суммарно
+// O(n log n)). Ребро внутри дерева замыкает цикл, и все блоки на пути
+// между концами сливаются в один. Блоки - системы непересекающихся
+// множеств над рёбрами леса; по пути идём прыжками к верхней вершине
+// блока, так что уже слитые участки цикла проходятся за один шаг.
+//
+// Мост - ребро леса, блок которого состоит из него одного. Точка
+// сочленения - вершина, рёбра леса которой лежат в двух и более блоках.
+// Петли и повторы рёбер леса ничего не меняют, как и в
+// NetworkAnalyzer::findCriticalElements.
+class IncrementalBiconnectivity {
+private:
+    struct TreeArc {
+        int to;
+        int edge;
+    };
+
+    int vertices_count;
+
+    // Лес: родитель (-1 у корня) и номер ребра к родителю
+    std::vector<int> parent;
+    std::vector<int> parent_edge;
+    std::vector<std::vector<TreeArc>> tree;
+
+    // Компоненты связности
+    mutable std::vector<int> component_link;
+    std::vector<int> component_size;
+
+    // Блоки над номерами рёбер леса: число рёбер и верхняя вершина
+    mutable std::vector<int> block_link;
+    std::vector<int> block_edges;
+    std::vector<int> block_top;
+
+    // Сколько разных блоков среди рёбер леса у вершины
+    std::vector<int> block_degree;
+
+    int bridges_count;
+    int articulation_count;
+
+    // Метки обхода: совпадение с stamp означает «в текущем проходе»
+    unsigned stamp;
+    std::vector<unsigned> mark_first;
+    std::vector<unsigned> mark_second;
+    std::vector<unsigned> top_stamp;
+    std::vector<int> path_first;
+    std::vector<int> path_second;
+    std::vector<int> queue;
+
+    int findComponent(int v) const;
+    int findBlock(int edge) const;
+    int uniteBlocks(int a, int b);
+
+    // Следующая вершина при подъёме: верх блока ребра к родителю
+    int jumpUp(int v) const { return block_top[findBlock(parent_edge[v])]; }
+
+    void changeBlockDegree(int v, int delta);
+
+    // Делает s корнем её дерева и пересчитывает верхние вершины блоков
+    void reroot(int s);
+    void linkTrees(int u, int v);
+    void closeCycle(int u, int v);
+
+public:
+    // Вершины 1..n, рёбер пока нет
+    explicit IncrementalBiconnectivity(int n);
+
+    // Амортизированно O(α(n)) плюс переподвешивание меньшего дерева
+    void addEdge(int u, int v);
+
+    bool connected(int u, int v) const;
+    bool isBridge(int u, int v) const;
+    bool isArticulationPoint(int v) const { return block_degree[v] >= 2; }
+
+    int getBridgesCount() const { return bridges_count; }
+    int getArticulationPointsCount() const { return articulation_count; }
+
+    // Текущие множества по возрастанию, за O(n log n)
+    std::vector<int> getArticulationPoints() const;
+    std::vector<std::pair<int, int>> getBridges() const;
+};
+
+#endif
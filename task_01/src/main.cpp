@@ -1,6 +1,53 @@
 #include "network_analyzer.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 
-int main() {
-    NetworkAnalyzer::solveNetworkProblem();
+namespace {
+
+int usage() {
+    std::fprintf(stderr, "usage: task_01 [--threads N] [--stream <file>]\n");
+    return 2;
+}
+
+}  // namespace
+
+// --stream <файл> - потоковый режим для входов, которые не помещаются в память
+// --threads N - параллельный поиск на N потоках (0 - по числу ядер),
+// по умолчанию последовательный DFS
+int main(int argc, char** argv) {
+    const char* stream_path = nullptr;
+    int threads = 1;
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 == argc) {
+            return usage();
+        }
+        if (std::strcmp(argv[i], "--stream") == 0) {
+            stream_path = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            char* end = nullptr;
+            long value = std::strtol(argv[i + 1], &end, 10);
+            if (*end != '\0' || end == argv[i + 1] || value < 0 || value > 4096) {
+                return usage();
+            }
+            threads = static_cast<int>(value);
+        } else {
+            return usage();
+        }
+    }
+
+    // Файл может не открыться, оборваться или оказаться повреждённым
+    // бинарным графом (GraphFile)
+    try {
+        if (stream_path != nullptr) {
+            NetworkAnalyzer::solveNetworkProblemStreaming(stream_path);
+        } else {
+            NetworkAnalyzer::solveNetworkProblem(threads);
+        }
+    } catch (const std::exception& error) {
+        std::fprintf(stderr, "task_01: %s\n", error.what());
+        return 1;
+    }
     return 0;
-}
\ No newline at end of file
+}
@@ -1,130 +1,240 @@
 #include "network_analyzer.hpp"
-#include <iostream>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "graph_file.hpp"
+#include "perf_stats.hpp"
+#include "streaming_biconnectivity.hpp"
+#include <unistd.h>
+#include <utility>
 #include <algorithm>
+#include <bit>
 
 NetworkAnalyzer::NetworkAnalyzer(int n) : Graph(n) {}
 
+NetworkAnalyzer::NetworkAnalyzer(CsrGraph adjacency) : Graph(std::move(adjacency)) {}
+
+void NetworkAnalyzer::addEdge(int u, int v) {
+    Graph::addEdge(u, v);
+    if (incremental) {
+        incremental->addEdge(u, v);
+    }
+}
+
+void NetworkAnalyzer::enableIncrementalMode() {
+    incremental = std::make_unique<IncrementalBiconnectivity>(vertices_count);
+    // Граф, заданный готовым CSR, ещё не имеет списка рёбер
+    auto initial = edges.empty() ? getAdjacencyList().toEdgeList(true) : edges;
+    for (const auto& [u, v] : initial) {
+        incremental->addEdge(u, v);
+    }
+}
+
 void NetworkAnalyzer::dfsCritical(
-    int vertex,
-    int parent,
-    std::vector<int>& tin,
-    std::vector<int>& low,
-    std::vector<Color>& colors,
+    int root,
+    DfsEngine& engine,
+    std::pmr::vector<VertexTimes>& times,
     int& timer,
-    std::set<int>& articulation_points,
+    std::pmr::vector<std::uint64_t>& articulation_bits,
     std::vector<std::pair<int, int>>& bridges
 ) const {
-    colors[vertex] = Color::Gray;
-    tin[vertex] = low[vertex] = timer++;
-    int children_count = 0;
-    
-    for (int neighbor : adjacency_list[vertex]) {
-        if (neighbor == parent) continue;
+    struct Visitor : DfsVisitor {
+        int root;
+        std::pmr::vector<VertexTimes>& times;
+        int& timer;
+        std::pmr::vector<std::uint64_t>& articulation_bits;
+        std::vector<std::pair<int, int>>& bridges;
+        int root_children = 0;
+        
+        void markArticulation(int vertex) {
+            articulation_bits[vertex >> 6] |= std::uint64_t{1} << (vertex & 63);
+        }
+        
+        void enter(int vertex, int) {
+            times[vertex].tin = times[vertex].low = ++timer;
+        }
+        
+        DfsAction edge(int vertex, int parent, int neighbor, long long) {
+            if (neighbor == parent) {
+                return DfsAction::Skip;
+            }
+            int neighbor_tin = times[neighbor].tin;
+            if (neighbor_tin == 0) {
+                return DfsAction::Descend;
+            }
+            // Уже посещённая вершина: обратное ребро
+            times[vertex].low = std::min(times[vertex].low, neighbor_tin);
+            return DfsAction::Skip;
+        }
         
-        switch (colors[neighbor]) {
-            case Color::White: {
-                dfsCritical(neighbor, vertex, tin, low, colors, timer, 
-                           articulation_points, bridges);
-                low[vertex] = std::min(low[vertex], low[neighbor]);
-                
-                if (low[neighbor] > tin[vertex]) {
-                    bridges.push_back({
-                        std::min(vertex, neighbor),
-                        std::max(vertex, neighbor)
-                    });
-                }
-                
-                if (low[neighbor] >= tin[vertex] && parent != -1) {
-                    articulation_points.insert(vertex);
-                }
-                
-                children_count++;
-                break;
+        void retreat(int vertex, int child, long long) {
+            VertexTimes& current = times[vertex];
+            int child_low = times[child].low;
+            current.low = std::min(current.low, child_low);
+            
+            if (child_low > current.tin) {
+                bridges.push_back({
+                    std::min(vertex, child),
+                    std::max(vertex, child)
+                });
             }
-            case Color::Gray: {
-                low[vertex] = std::min(low[vertex], tin[neighbor]);
-                break;
+            
+            if (vertex == root) {
+                root_children++;
+            } else if (child_low >= current.tin) {
+                markArticulation(vertex);
             }
-            case Color::Black: {
-                low[vertex] = std::min(low[vertex], tin[neighbor]);
-                break;
+        }
+        
+        void leave(int vertex, int) {
+            if (vertex == root && root_children > 1) {
+                markArticulation(vertex);
             }
         }
-    }
+    };
     
-    if (parent == -1 && children_count > 1) {
-        articulation_points.insert(vertex);
-    }
-    
-    colors[vertex] = Color::Black;
+    Visitor visitor{{}, root, times, timer, articulation_bits, bridges};
+    engine.run(adjacency_list, root, visitor);
 }
 
 std::pair<std::vector<int>, std::vector<std::pair<int, int>>> 
 NetworkAnalyzer::findCriticalElements() const {
-    std::vector<int> tin(vertices_count + 1, 0);
-    std::vector<int> low(vertices_count + 1, 0);
-    std::vector<Color> colors(vertices_count + 1, Color::White);
-    std::set<int> articulation_points_set;
+    if (incremental) {
+        return {incremental->getArticulationPoints(), incremental->getBridges()};
+    }
+    ScratchWorkspace workspace;
+    return findCriticalElements(workspace);
+}
+
+std::pair<std::vector<int>, std::vector<std::pair<int, int>>> 
+NetworkAnalyzer::findCriticalElements(ScratchWorkspace& workspace) const {
+    std::vector<int> articulation_points;
     std::vector<std::pair<int, int>> bridges;
+    findCriticalElements(workspace, articulation_points, bridges);
+    return {articulation_points, bridges};
+}
+
+void NetworkAnalyzer::findCriticalElements(
+    ScratchWorkspace& workspace,
+    std::vector<int>& articulation_points,
+    std::vector<std::pair<int, int>>& bridges
+) const {
+    {
+        PERF_PHASE("critical.build");
+        getAdjacencyList();
+    }
+    PERF_PHASE("critical.search");
+    workspace.reset();
+    
+    auto times = workspace.makeVector<VertexTimes>(vertices_count + 1, {0, 0});
+    auto articulation_bits = workspace.makeVector<std::uint64_t>((vertices_count >> 6) + 1, 0);
+    bridges.clear();
     int timer = 0;
+    DfsEngine engine(workspace.getResource());
     
     for (int v = 1; v <= vertices_count; ++v) {
-        if (colors[v] == Color::White) {
-            dfsCritical(v, -1, tin, low, colors, timer, 
-                       articulation_points_set, bridges);
+        if (times[v].tin == 0) {
+            dfsCritical(v, engine, times, timer, articulation_bits, bridges);
         }
     }
     
-    std::vector<int> articulation_points(
-        articulation_points_set.begin(), 
-        articulation_points_set.end()
-    );
+    // Слова битового массива по порядку дают вершины по возрастанию
+    articulation_points.clear();
+    for (std::size_t word = 0; word < articulation_bits.size(); ++word) {
+        for (std::uint64_t bits = articulation_bits[word]; bits != 0; bits &= bits - 1) {
+            articulation_points.push_back(static_cast<int>(word * 64 + std::countr_zero(bits)));
+        }
+    }
     
     std::sort(bridges.begin(), bridges.end());
-    
-    return {articulation_points, bridges};
 }
 
-void NetworkAnalyzer::solveNetworkProblem() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
-    
-    int n, m;
-    std::cin >> n >> m;
+std::vector<int> NetworkAnalyzer::simulateFailures(
+    const std::vector<FailureScenario>& scenarios,
+    int threads
+) const {
+    return FailureOracle(*this).countComponentsBatch(scenarios, threads);
+}
+
+NetworkAnalyzer NetworkAnalyzer::readTextInput() {
+    PERF_PHASE("critical.read");
+    FastReader input;
+    int n = input.readInt();
+    int m = input.readInt();
     
     NetworkAnalyzer analyzer(n);
     
     for (int i = 0; i < m; ++i) {
-        int u, v;
-        std::cin >> u >> v;
+        int u = input.readInt();
+        int v = input.readInt();
         analyzer.addEdge(u, v);
     }
     
     analyzer.sortAdjacencyLists();
+    return analyzer;
+}
+
+void NetworkAnalyzer::solveNetworkProblem(int threads) {
+    FastWriter output;
+    
+    // Бинарный файл графа (см. graph_convert) используется без разбора текста
+    if (GraphFile::isGraphFile(STDIN_FILENO)) {
+        GraphFileHeader header;
+        CsrGraph graph = GraphFile::load(STDIN_FILENO, &header);
+        GraphFile::requireLayout(header, GraphFile::Undirected | GraphFile::OneBased);
+        NetworkAnalyzer analyzer(std::move(graph));
+        if (!(header.flags & GraphFile::SortedNeighbors)) {
+            analyzer.sortAdjacencyLists();
+        }
+        analyzer.printCriticalElements(output, threads);
+        return;
+    }
     
-    auto [articulation_points, bridges] = analyzer.findCriticalElements();
-    
-    std::cout << articulation_points.size() << "\n";
+    readTextInput().printCriticalElements(output, threads);
+}
+
+void NetworkAnalyzer::solveNetworkProblemStreaming(const std::string& path) {
+    FastWriter output;
+    auto [articulation_points, bridges] = StreamingBiconnectivity::findInFile(path);
+    writeCriticalElements(output, articulation_points, bridges);
+}
+
+void NetworkAnalyzer::printCriticalElements(FastWriter& output, int threads) const {
+    auto [articulation_points, bridges] = threads == 1
+        ? findCriticalElements()
+        : findCriticalElementsParallel(threads);
+    writeCriticalElements(output, articulation_points, bridges);
+}
+
+void NetworkAnalyzer::writeCriticalElements(
+    FastWriter& output,
+    const std::vector<int>& articulation_points,
+    const std::vector<std::pair<int, int>>& bridges
+) {
+    output.writeInt(articulation_points.size());
+    output.writeChar('\n');
     
     if (articulation_points.empty()) {
-        std::cout << "-\n";
+        output.writeString("-\n");
     } else {
         for (size_t i = 0; i < articulation_points.size(); ++i) {
-            if (i > 0) std::cout << " ";
-            std::cout << articulation_points[i];
+            if (i > 0) output.writeChar(' ');
+            output.writeInt(articulation_points[i]);
         }
-        std::cout << "\n";
+        output.writeChar('\n');
     }
     
-    std::cout << bridges.size() << "\n";
+    output.writeInt(bridges.size());
+    output.writeChar('\n');
     
     if (bridges.empty()) {
-        std::cout << "-\n";
+        output.writeString("-\n");
     } else {
         for (size_t i = 0; i < bridges.size(); ++i) {
-            if (i > 0) std::cout << "; ";
-            std::cout << bridges[i].first << " " << bridges[i].second;
+            if (i > 0) output.writeString("; ");
+            output.writeInt(bridges[i].first);
+            output.writeChar(' ');
+            output.writeInt(bridges[i].second);
         }
-        std::cout << "\n";
+        output.writeChar('\n');
     }
 }
\ No newline at end of file
@@ -2,33 +2,99 @@
 #define NETWORK_ANALYZER_HPP
 
 #include "graph.hpp"
+#include "arena.hpp"
+#include "dfs_engine.hpp"
+#include "incremental_biconnectivity.hpp"
+#include "failure_oracle.hpp"
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
 #include <vector>
 #include <utility>
-#include <set>
+
+class FastWriter;
 
 class NetworkAnalyzer : public Graph {
 private:
-    // DFS для поиска критических элементов
+    // tin и low вершины рядом в памяти: retreat читает оба сразу.
+    // tin == 0 - вершина ещё не посещена, отсчёт времени с 1
+    struct VertexTimes {
+        int tin;
+        int low;
+    };
+    
+    // DFS для поиска критических элементов из корня root (без рекурсии).
+    // Точки сочленения отмечаются битами в articulation_bits
     void dfsCritical(
-        int vertex, 
-        int parent, 
-        std::vector<int>& tin, 
-        std::vector<int>& low,
-        std::vector<Color>& colors,
+        int root,
+        DfsEngine& engine,
+        std::pmr::vector<VertexTimes>& times,
         int& timer,
-        std::set<int>& articulation_points,
+        std::pmr::vector<std::uint64_t>& articulation_bits,
         std::vector<std::pair<int, int>>& bridges
     ) const;
     
+    // Поддерживаемые при добавлении рёбер мосты и точки сочленения
+    std::unique_ptr<IncrementalBiconnectivity> incremental;
+    
+    // Чтение текстового ввода задачи
+    static NetworkAnalyzer readTextInput();
+    
+    // Вывод ответа в формате задачи; threads > 1 - параллельный поиск
+    void printCriticalElements(FastWriter& output, int threads) const;
+    static void writeCriticalElements(
+        FastWriter& output,
+        const std::vector<int>& articulation_points,
+        const std::vector<std::pair<int, int>>& bridges
+    );
+    
 public:
     NetworkAnalyzer(int n);
+    explicit NetworkAnalyzer(CsrGraph adjacency);
+    
+    // Скрывает Graph::addEdge, чтобы обновлять инкрементальный режим
+    void addEdge(int u, int v);
+    
+    // Инкрементальный режим: дальнейшие addEdge обновляют мосты и точки
+    // сочленения за амортизированно почти O(1), а findCriticalElements()
+    // возвращает готовые множества без обхода графа
+    void enableIncrementalMode();
+    bool isIncremental() const { return incremental != nullptr; }
+    // Текущее состояние; только в инкрементальном режиме
+    const IncrementalBiconnectivity& getIncremental() const { return *incremental; }
     
     // Основной метод для поиска критических элементов
     std::pair<std::vector<int>, std::vector<std::pair<int, int>>> 
     findCriticalElements() const;
+    // То же с переиспользуемой рабочей памятью для tin/low, битов точек и стека DFS
+    std::pair<std::vector<int>, std::vector<std::pair<int, int>>> 
+    findCriticalElements(ScratchWorkspace& workspace) const;
+    // Ответ в буферы вызывающего: их ёмкость и workspace переиспользуются,
+    // так что повторные вызовы на том же графе не выделяют память в куче
+    void findCriticalElements(
+        ScratchWorkspace& workspace,
+        std::vector<int>& articulation_points,
+        std::vector<std::pair<int, int>>& bridges
+    ) const;
+    // Параллельный поиск по Тарьяну - Вишкину (parallel_biconnectivity.cpp);
+    // ответ тот же, threads <= 0 - по числу аппаратных потоков
+    std::pair<std::vector<int>, std::vector<std::pair<int, int>>> 
+    findCriticalElementsParallel(int threads) const;
+    
+    // Число компонент после каждого сценария отказов; структура для запросов
+    // строится один раз (failure_oracle.hpp), сценарии идут на threads потоках.
+    // Для повторных пакетов выгоднее держать свой FailureOracle
+    std::vector<int> simulateFailures(
+        const std::vector<FailureScenario>& scenarios,
+        int threads = 1
+    ) const;
     
     // Статический метод для решения задачи (полный ввод/вывод)
-    static void solveNetworkProblem();
+    static void solveNetworkProblem(int threads = 1);
+    // То же для текстового файла, который не помещается в память: два
+    // прохода по рёбрам без списков смежности (streaming_biconnectivity.hpp)
+    static void solveNetworkProblemStreaming(const std::string& path);
 };
 
 #endif // NETWORK_ANALYZER_HPP
\ No newline at end of file
@@ -0,0 +1,283 @@
+#include "network_analyzer.hpp"
+#include "perf_stats.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+// Параллельный поиск точек сочленения и мостов по Тарьяну - Вишкину.
+//
+// 1. Остовный лес строится обходом в ширину по уровням: вершины уровня
+//    делятся между потоками, новая вершина захватывается CAS по parent.
+// 2. По уровням снизу вверх считаются размеры поддеревьев, сверху вниз -
+//    номера в прямом порядке pre (поддерево v занимает [pre, pre + size)).
+// 3. low/high - минимум и максимум pre по поддереву и по концам рёбер
+//    вне дерева, выходящих из него. Ребро дерева (p, v) - мост, если ни
+//    одно такое ребро не ведёт из поддерева v наружу.
+// 4. Рёбра дерева (номер - нижняя вершина) склеиваются в блоки: через
+//    поперечное ребро между поддеревьями и через ребро из поддерева v
+//    за пределы поддерева p. Вершина - точка сочленения, если её рёбра
+//    дерева попали в разные блоки.
+//
+// Кратные рёбра между вершиной и её родителем считаются одним ребром
+// дерева, как и в последовательной версии, поэтому ответ совпадает.
+
+namespace {
+
+// Размер куска работы для одного потока
+constexpr std::size_t kGrain = 2048;
+
+// Система непересекающихся множеств с атомарными ссылками: объединения
+// и поиски можно вызывать одновременно из разных потоков
+class ConcurrentDisjointSets {
+private:
+    std::vector<int> link;
+
+public:
+    explicit ConcurrentDisjointSets(int n) : link(n) {
+        std::iota(link.begin(), link.end(), 0);
+    }
+
+    int find(int x) {
+        while (true) {
+            int p = std::atomic_ref<int>(link[x]).load(std::memory_order_acquire);
+            if (p == x) {
+                return x;
+            }
+            int grandparent = std::atomic_ref<int>(link[p]).load(std::memory_order_acquire);
+            if (grandparent != p) {
+                // Сокращение пути вдвое; неудача CAS не мешает подъёму
+                std::atomic_ref<int>(link[x]).compare_exchange_weak(
+                    p, grandparent, std::memory_order_acq_rel);
+            }
+            x = grandparent;
+        }
+    }
+
+    void unite(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) {
+                return;
+            }
+            // Больший корень подвешивается к меньшему
+            if (a < b) {
+                std::swap(a, b);
+            }
+            int expected = a;
+            if (std::atomic_ref<int>(link[a]).compare_exchange_strong(
+                    expected, b, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+};
+
+}
+
+std::pair<std::vector<int>, std::vector<std::pair<int, int>>>
+NetworkAnalyzer::findCriticalElementsParallel(int threads) const {
+    const CsrGraph& graph = getAdjacencyList();
+    ThreadPool pool(threads);
+    int n = graph.getVerticesCount();
+
+    std::vector<int> parent(n, -1);
+    std::vector<int> order;
+    std::vector<std::size_t> levels;   // уровень i - order[levels[i] .. levels[i + 1])
+    std::vector<int> roots;
+    order.reserve(n);
+
+    {
+        PERF_PHASE("critical.parallel.spanning_forest");
+        std::vector<std::vector<int>> next_level(pool.getThreadsCount());
+
+        for (int root = 0; root < n; ++root) {
+            if (parent[root] != -1) {
+                continue;
+            }
+            parent[root] = root;
+            roots.push_back(root);
+            levels.push_back(order.size());
+            order.push_back(root);
+
+            std::size_t begin = levels.back();
+            while (true) {
+                std::size_t end = order.size();
+                pool.parallelFor(begin, end, kGrain, [&](std::size_t from, std::size_t to, int thread) {
+                    std::vector<int>& found = next_level[thread];
+                    for (std::size_t i = from; i < to; ++i) {
+                        int v = order[i];
+                        for (int w : graph.getNeighbors(v)) {
+                            std::atomic_ref<int> slot(parent[w]);
+                            int expected = -1;
+                            if (slot.load(std::memory_order_relaxed) == -1 &&
+                                slot.compare_exchange_strong(expected, v, std::memory_order_relaxed)) {
+                                found.push_back(w);
+                            }
+                        }
+                    }
+                });
+
+                for (std::vector<int>& found : next_level) {
+                    order.insert(order.end(), found.begin(), found.end());
+                    found.clear();
+                }
+                if (order.size() == end) {
+                    break;
+                }
+                begin = end;
+                levels.push_back(begin);
+            }
+        }
+        levels.push_back(order.size());
+    }
+
+    // Дети каждой вершины подряд: children[child_start[v] .. child_start[v + 1])
+    std::vector<int> child_start(n + 1, 0);
+    std::vector<int> children(n - roots.size());
+    {
+        PERF_PHASE("critical.parallel.children");
+        for (int v = 0; v < n; ++v) {
+            if (parent[v] != v) {
+                ++child_start[parent[v] + 1];
+            }
+        }
+        std::partial_sum(child_start.begin(), child_start.end(), child_start.begin());
+        std::vector<int> cursor(child_start.begin(), child_start.end() - 1);
+        for (int v : order) {
+            if (parent[v] != v) {
+                children[cursor[parent[v]]++] = v;
+            }
+        }
+    }
+
+    auto forEachLevel = [&](bool bottom_up, auto&& fn) {
+        std::size_t count = levels.size() - 1;
+        for (std::size_t step = 0; step < count; ++step) {
+            std::size_t level = bottom_up ? count - 1 - step : step;
+            pool.parallelFor(levels[level], levels[level + 1], kGrain,
+                             [&](std::size_t from, std::size_t to, int) {
+                for (std::size_t i = from; i < to; ++i) {
+                    fn(order[i]);
+                }
+            });
+        }
+    };
+
+    std::vector<int> subtree_size(n);
+    std::vector<int> pre(n);
+    {
+        PERF_PHASE("critical.parallel.numbering");
+        forEachLevel(true, [&](int v) {
+            int total = 1;
+            for (int i = child_start[v]; i < child_start[v + 1]; ++i) {
+                total += subtree_size[children[i]];
+            }
+            subtree_size[v] = total;
+        });
+
+        int base = 0;
+        for (int root : roots) {
+            pre[root] = base;
+            base += subtree_size[root];
+        }
+        forEachLevel(false, [&](int v) {
+            int next = pre[v] + 1;
+            for (int i = child_start[v]; i < child_start[v + 1]; ++i) {
+                pre[children[i]] = next;
+                next += subtree_size[children[i]];
+            }
+        });
+    }
+
+    auto isTreeEdge = [&](int v, int w) {
+        return parent[v] == w || parent[w] == v;
+    };
+
+    std::vector<int> low(n);
+    std::vector<int> high(n);
+    {
+        PERF_PHASE("critical.parallel.low_high");
+        forEachLevel(true, [&](int v) {
+            int lowest = pre[v];
+            int highest = pre[v];
+            for (int w : graph.getNeighbors(v)) {
+                if (!isTreeEdge(v, w)) {
+                    lowest = std::min(lowest, pre[w]);
+                    highest = std::max(highest, pre[w]);
+                }
+            }
+            for (int i = child_start[v]; i < child_start[v + 1]; ++i) {
+                lowest = std::min(lowest, low[children[i]]);
+                highest = std::max(highest, high[children[i]]);
+            }
+            low[v] = lowest;
+            high[v] = highest;
+        });
+    }
+
+    ConcurrentDisjointSets blocks(n);
+    {
+        PERF_PHASE("critical.parallel.blocks");
+        pool.parallelFor(0, n, kGrain, [&](std::size_t from, std::size_t to, int) {
+            for (int v = static_cast<int>(from); v < static_cast<int>(to); ++v) {
+                if (parent[v] == v) {
+                    continue;
+                }
+                // Поперечное ребро: концы не предки друг друга
+                for (int w : graph.getNeighbors(v)) {
+                    if (!isTreeEdge(v, w) && pre[v] < pre[w] &&
+                        pre[w] >= pre[v] + subtree_size[v]) {
+                        blocks.unite(v, w);
+                    }
+                }
+                // Из поддерева v есть ребро за пределы поддерева родителя
+                int p = parent[v];
+                if (parent[p] != p &&
+                    (low[v] < pre[p] || high[v] >= pre[p] + subtree_size[p])) {
+                    blocks.unite(v, p);
+                }
+            }
+        });
+    }
+
+    std::vector<std::vector<int>> local_points(pool.getThreadsCount());
+    std::vector<std::vector<std::pair<int, int>>> local_bridges(pool.getThreadsCount());
+    {
+        PERF_PHASE("critical.parallel.collect");
+        pool.parallelFor(0, n, kGrain, [&](std::size_t from, std::size_t to, int thread) {
+            for (int v = static_cast<int>(from); v < static_cast<int>(to); ++v) {
+                int p = parent[v];
+                if (p != v && low[v] >= pre[v] && high[v] < pre[v] + subtree_size[v]) {
+                    local_bridges[thread].push_back({std::min(p, v), std::max(p, v)});
+                }
+
+                int begin = child_start[v];
+                int end = child_start[v + 1];
+                if (begin == end) {
+                    continue;
+                }
+                int block = p == v ? blocks.find(children[begin]) : blocks.find(v);
+                for (int i = begin; i < end; ++i) {
+                    if (blocks.find(children[i]) != block) {
+                        local_points[thread].push_back(v);
+                        break;
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<int> articulation_points;
+    std::vector<std::pair<int, int>> bridges;
+    for (int thread = 0; thread < pool.getThreadsCount(); ++thread) {
+        articulation_points.insert(articulation_points.end(),
+                                   local_points[thread].begin(), local_points[thread].end());
+        bridges.insert(bridges.end(), local_bridges[thread].begin(), local_bridges[thread].end());
+    }
+    std::sort(articulation_points.begin(), articulation_points.end());
+    std::sort(bridges.begin(), bridges.end());
+
+    return {articulation_points, bridges};
+}
@@ -0,0 +1,210 @@
+#include "streaming_biconnectivity.hpp"
+#include "csr_graph.hpp"
+#include "fast_input.hpp"
+#include "perf_stats.hpp"
+#include <algorithm>
+#include <numeric>
+
+StreamingBiconnectivity::StreamingBiconnectivity(int n)
+    : vertices_count(n),
+      component_link(n + 1),
+      finished(false) {
+    std::iota(component_link.begin(), component_link.end(), 0);
+    forest_edges.reserve(n);
+}
+
+int StreamingBiconnectivity::find(std::vector<int>& link, int x) {
+    while (link[x] != x) {
+        link[x] = link[link[x]];
+        x = link[x];
+    }
+    return x;
+}
+
+void StreamingBiconnectivity::unite(std::vector<int>& link, int a, int b) {
+    a = find(link, a);
+    b = find(link, b);
+    if (a != b) {
+        link[std::max(a, b)] = std::min(a, b);
+    }
+}
+
+void StreamingBiconnectivity::scanForest(int u, int v) {
+    int root_u = find(component_link, u);
+    int root_v = find(component_link, v);
+    if (root_u != root_v) {
+        component_link[std::max(root_u, root_v)] = std::min(root_u, root_v);
+        forest_edges.push_back({u, v});
+    }
+}
+
+void StreamingBiconnectivity::finishForest() {
+    PERF_PHASE("critical.streaming.forest");
+    int n = vertices_count + 1;
+    {
+        CsrGraph forest = CsrGraph::fromEdges(n, forest_edges, true);
+        std::vector<std::pair<int, int>>().swap(forest_edges);
+        std::vector<int>().swap(component_link);
+
+        parent.assign(n, -1);
+        order.reserve(n);
+        for (int root = 0; root < n; ++root) {
+            if (parent[root] != -1) {
+                continue;
+            }
+            parent[root] = root;
+            order.push_back(root);
+            for (std::size_t i = order.size() - 1; i < order.size(); ++i) {
+                int v = order[i];
+                for (int w : forest.getNeighbors(v)) {
+                    if (parent[w] == -1) {
+                        parent[w] = v;
+                        order.push_back(w);
+                    }
+                }
+            }
+        }
+    }
+
+    // Размеры снизу вверх, затем pre сверху вниз: дети получают подряд
+    // идущие отрезки внутри отрезка родителя
+    subtree_size.assign(n, 1);
+    for (int i = n - 1; i >= 0; --i) {
+        int v = order[i];
+        if (parent[v] != v) {
+            subtree_size[parent[v]] += subtree_size[v];
+        }
+    }
+    pre.assign(n, 0);
+    std::vector<int> next(n);
+    int base = 0;
+    for (int v : order) {
+        if (parent[v] == v) {
+            pre[v] = base;
+            base += subtree_size[v];
+        } else {
+            pre[v] = next[parent[v]];
+            next[parent[v]] += subtree_size[v];
+        }
+        next[v] = pre[v] + 1;
+    }
+
+    low = pre;
+    high = pre;
+    block_link.resize(n);
+    std::iota(block_link.begin(), block_link.end(), 0);
+}
+
+void StreamingBiconnectivity::scanCertificate(int u, int v) {
+    // Петли, рёбра леса и их повторы
+    if (u == v || parent[u] == v || parent[v] == u) {
+        return;
+    }
+    low[u] = std::min(low[u], pre[v]);
+    high[u] = std::max(high[u], pre[v]);
+    low[v] = std::min(low[v], pre[u]);
+    high[v] = std::max(high[v], pre[u]);
+
+    // Концы не предки друг друга: рёбра к их родителям в одном блоке
+    if (!inSubtree(u, v) && !inSubtree(v, u)) {
+        unite(block_link, u, v);
+    }
+}
+
+void StreamingBiconnectivity::finish() {
+    if (finished) {
+        return;
+    }
+    finished = true;
+    PERF_PHASE("critical.streaming.finish");
+
+    for (int i = vertices_count; i >= 0; --i) {
+        int v = order[i];
+        int p = parent[v];
+        if (p != v) {
+            low[p] = std::min(low[p], low[v]);
+            high[p] = std::max(high[p], high[v]);
+        }
+    }
+
+    // Из поддерева v есть ребро за пределы поддерева родителя
+    for (int v = 0; v <= vertices_count; ++v) {
+        int p = parent[v];
+        if (p != v && parent[p] != p &&
+            (low[v] < pre[p] || high[v] >= pre[p] + subtree_size[p])) {
+            unite(block_link, v, p);
+        }
+    }
+}
+
+std::vector<int> StreamingBiconnectivity::getArticulationPoints() {
+    finish();
+    // Первый ребёнок каждой вершины и признак «дети в разных блоках»
+    std::vector<int> first_child(vertices_count + 1, -1);
+    std::vector<char> is_point(vertices_count + 1, 0);
+    for (int v : order) {
+        int p = parent[v];
+        if (p == v) {
+            continue;
+        }
+        if (first_child[p] == -1) {
+            first_child[p] = v;
+        }
+        int block = parent[p] == p ? find(block_link, first_child[p]) : find(block_link, p);
+        if (find(block_link, v) != block) {
+            is_point[p] = 1;
+        }
+    }
+
+    std::vector<int> points;
+    for (int v = 1; v <= vertices_count; ++v) {
+        if (is_point[v]) {
+            points.push_back(v);
+        }
+    }
+    return points;
+}
+
+std::vector<std::pair<int, int>> StreamingBiconnectivity::getBridges() {
+    finish();
+    std::vector<std::pair<int, int>> bridges;
+    for (int v = 1; v <= vertices_count; ++v) {
+        int p = parent[v];
+        if (p != v && low[v] >= pre[v] && high[v] < pre[v] + subtree_size[v]) {
+            bridges.push_back({std::min(p, v), std::max(p, v)});
+        }
+    }
+    std::sort(bridges.begin(), bridges.end());
+    return bridges;
+}
+
+std::pair<std::vector<int>, std::vector<std::pair<int, int>>>
+StreamingBiconnectivity::findInFile(const std::string& path) {
+    auto scan = [&](auto&& fn) {
+        FastReader input(path);
+        input.readInt();
+        long long m = input.readLong();
+        for (long long i = 0; i < m; ++i) {
+            int u = input.readInt();
+            int v = input.readInt();
+            fn(u, v);
+        }
+    };
+
+    int n;
+    {
+        FastReader input(path);
+        n = input.readInt();
+    }
+    StreamingBiconnectivity streaming(n);
+    {
+        PERF_PHASE("critical.streaming.pass_forest");
+        scan([&](int u, int v) { streaming.scanForest(u, v); });
+    }
+    streaming.finishForest();
+    {
+        PERF_PHASE("critical.streaming.pass_certificate");
+        scan([&](int u, int v) { streaming.scanCertificate(u, v); });
+    }
+    return {streaming.getArticulationPoints(), streaming.getBridges()};
+}
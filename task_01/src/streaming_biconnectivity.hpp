@@ -0,0 +1,71 @@
+#ifndef STREAMING_BICONNECTIVITY_HPP
+#define STREAMING_BICONNECTIVITY_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// Мосты и точки сочленения по потоку рёбер, который не помещается в память.
+// Поток читается два раза подряд, памяти O(n), списки смежности не строятся.
+//
+// Проход 1: остовный лес через систему непересекающихся множеств - ребро
+// между разными компонентами идёт в лес. Затем лес подвешивается, вершины
+// нумеруются в прямом порядке pre: поддерево v - [pre[v], pre[v] + size[v]).
+// Проход 2: как в Тарьяне - Вишкине (см. parallel_biconnectivity.cpp), рёбра
+// вне леса дают low/high своих концов и склеивают блоки, если их концы не
+// предки друг друга. Остальное считается по лесу без обращения к потоку.
+//
+// Кратные рёбра и петли ничего не меняют, как и в
+// NetworkAnalyzer::findCriticalElements, поэтому ответ совпадает.
+//
+// Использование: scanForest на каждое ребро, finishForest, scanCertificate
+// на каждое ребро того же потока, затем getArticulationPoints/getBridges.
+class StreamingBiconnectivity {
+private:
+    int vertices_count;
+
+    // Проход 1: компоненты и рёбра леса
+    std::vector<int> component_link;
+    std::vector<std::pair<int, int>> forest_edges;
+
+    // Подвешенный лес: parent[v] == v у корня, order - порядок обхода в ширину
+    std::vector<int> parent;
+    std::vector<int> order;
+    std::vector<int> pre;
+    std::vector<int> subtree_size;
+
+    // Проход 2: low/high и блоки над рёбрами леса (номер - нижняя вершина)
+    std::vector<int> low;
+    std::vector<int> high;
+    std::vector<int> block_link;
+
+    bool finished;
+
+    static int find(std::vector<int>& link, int x);
+    static void unite(std::vector<int>& link, int a, int b);
+
+    bool inSubtree(int root, int v) const {
+        return pre[root] <= pre[v] && pre[v] < pre[root] + subtree_size[root];
+    }
+
+    // Поднимает low/high по лесу и склеивает блоки через родителя
+    void finish();
+
+public:
+    // Вершины 1..n
+    explicit StreamingBiconnectivity(int n);
+
+    void scanForest(int u, int v);
+    void finishForest();
+    void scanCertificate(int u, int v);
+
+    // Точки по возрастанию, мосты (u < v) в лексикографическом порядке
+    std::vector<int> getArticulationPoints();
+    std::vector<std::pair<int, int>> getBridges();
+
+    // Текстовый файл в формате задачи; каждый проход читает его заново
+    static std::pair<std::vector<int>, std::vector<std::pair<int, int>>>
+    findInFile(const std::string& path);
+};
+
+#endif
@@ -1,6 +1,18 @@
 #include <gtest/gtest.h>
 #include "graph.hpp"
 #include "network_analyzer.hpp"
+#include "block_cut_index.hpp"
+#include "incremental_biconnectivity.hpp"
+#include "streaming_biconnectivity.hpp"
+#include "failure_oracle.hpp"
+#include "graph_file.hpp"
+#include "graph_generator.hpp"
+#include "heap_counter.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <set>
+#include <fcntl.h>
+#include <unistd.h>
 
 // Вспомогательная функция для нормализации ребра
 std::pair<int, int> normalizeEdge(int u, int v) {
@@ -20,6 +32,115 @@ TEST(GraphTest, ConstructionAndEdges) {
     EXPECT_EQ(graph.getNeighbors(3).size(), 1);
 }
 
+TEST(CsrGraphTest, DirectedWithReverse) {
+    CsrGraph graph = CsrGraph::fromEdges(4, {{0, 1}, {0, 2}, {2, 1}, {3, 0}});
+    
+    EXPECT_EQ(graph.getVerticesCount(), 4);
+    EXPECT_EQ(graph.getEdgesCount(), 4);
+    EXPECT_EQ(std::vector<int>(graph.getNeighbors(0).begin(), graph.getNeighbors(0).end()),
+              std::vector<int>({1, 2}));
+    EXPECT_TRUE(graph.getNeighbors(1).empty());
+    
+    CsrGraph reversed = graph.reversed();
+    EXPECT_EQ(std::vector<int>(reversed.getNeighbors(1).begin(), reversed.getNeighbors(1).end()),
+              std::vector<int>({0, 2}));
+    EXPECT_EQ(reversed.getDegree(0), 1);
+    EXPECT_EQ(reversed.getNeighbors(0)[0], 3);
+}
+
+TEST(CsrGraphTest, WeightsAndEdgeIdsFollowSort) {
+    CsrGraph graph = CsrGraph::fromWeightedEdges(
+        3, {{0, 2}, {0, 1}, {1, 2}}, {7, 5, 3}, true, true);
+    
+    EXPECT_TRUE(graph.hasWeights());
+    EXPECT_EQ(graph.getEdgesCount(), 6);
+    EXPECT_EQ(graph.getNeighbors(0)[0], 2);
+    
+    graph.sortNeighbors();
+    
+    EXPECT_EQ(graph.getNeighbors(0)[0], 1);
+    EXPECT_EQ(graph.getWeights(0)[0], 5);
+    EXPECT_EQ(graph.getEdgeIds(0)[0], 1);
+    EXPECT_EQ(graph.getNeighbors(0)[1], 2);
+    EXPECT_EQ(graph.getWeights(0)[1], 7);
+    EXPECT_EQ(graph.getEdgeIds(2)[1], 2);
+}
+
+TEST(GraphFileTest, RoundTripIsMappedInPlace) {
+    char path[] = "/tmp/graph_file_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    
+    // Цепочка 1-2-3-4 в раскладке task_01 (строка 0 пустая)
+    CsrGraph source = CsrGraph::fromEdges(5, {{1, 2}, {2, 3}, {3, 4}}, true);
+    source.sortNeighbors();
+    GraphFile::save(path, source, GraphFile::Undirected | GraphFile::OneBased, 4);
+    
+    GraphFileHeader header;
+    CsrGraph loaded = GraphFile::load(std::string(path), &header);
+    std::remove(path);
+    
+    EXPECT_TRUE(loaded.isExternal());
+    EXPECT_EQ(header.vertices_count, 4);
+    EXPECT_TRUE(header.flags & GraphFile::OneBased);
+    EXPECT_EQ(loaded.getVerticesCount(), 5);
+    EXPECT_EQ(loaded.getEdgesCount(), 6);
+    EXPECT_EQ(loaded.getNeighbors(2)[0], 1);
+    EXPECT_EQ(loaded.getNeighbors(2)[1], 3);
+    
+    NetworkAnalyzer analyzer(loaded);
+    auto [articulation_points, bridges] = analyzer.findCriticalElements();
+    EXPECT_EQ(articulation_points, std::vector<int>({2, 3}));
+    EXPECT_EQ(bridges.size(), 3);
+    
+    // Добавление ребра поверх загруженного графа замыкает цикл
+    analyzer.addEdge(4, 1);
+    auto [points_after, bridges_after] = analyzer.findCriticalElements();
+    EXPECT_TRUE(points_after.empty());
+    EXPECT_TRUE(bridges_after.empty());
+}
+
+TEST(GraphFileTest, RejectsCorruptedArraysAndForeignLayout) {
+    char path[] = "/tmp/graph_file_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    
+    // Ориентированный граф в раскладке task_03
+    CsrGraph source = CsrGraph::fromEdges(3, {{0, 1}, {1, 2}});
+    GraphFile::save(path, source, 0, 3);
+    GraphFileHeader header;
+    CsrGraph loaded = GraphFile::load(std::string(path), &header);
+    EXPECT_NO_THROW(GraphFile::requireLayout(header, 0));
+    EXPECT_THROW(GraphFile::requireLayout(header, GraphFile::Undirected | GraphFile::OneBased),
+                 std::runtime_error);
+    
+    auto patch = [&](std::uint64_t position, const auto& value) {
+        int file = open(path, O_WRONLY);
+        ASSERT_EQ(pwrite(file, &value, sizeof(value), position), static_cast<ssize_t>(sizeof(value)));
+        close(file);
+    };
+    
+    // Конец дуги вне [0, rows)
+    patch(header.targets_position + sizeof(int), 7);
+    EXPECT_THROW(GraphFile::load(std::string(path)), std::runtime_error);
+    patch(header.targets_position + sizeof(int), 2);
+    EXPECT_NO_THROW(GraphFile::load(std::string(path)));
+    
+    // Убывающие смещения при верных первом и последнем
+    patch(header.offsets_position + 2 * sizeof(long long), 0LL);
+    EXPECT_THROW(GraphFile::load(std::string(path)), std::runtime_error);
+    
+    // Номер ребра вне [0, slots)
+    GraphFile::save(path, CsrGraph::fromEdges(3, {{0, 1}, {1, 2}}, false, true), 0, 3);
+    GraphFile::load(std::string(path), &header);
+    ASSERT_TRUE(header.flags & GraphFile::WithEdgeIds);
+    patch(header.edge_ids_position, -1);
+    EXPECT_THROW(GraphFile::load(std::string(path)), std::runtime_error);
+    std::remove(path);
+}
+
 TEST(NetworkAnalyzerTest, SingleEdgeGraph) {
     NetworkAnalyzer analyzer(2);
     analyzer.addEdge(1, 2);
@@ -144,6 +265,425 @@ TEST(NetworkAnalyzerTest, SingleVertex) {
     EXPECT_TRUE(bridges.empty());
 }
 
+TEST(NetworkAnalyzerTest, DeepPathDoesNotOverflowStack) {
+    const int n = 1000000;
+    NetworkAnalyzer analyzer(n);
+    for (int v = 2; v <= n; ++v) {
+        analyzer.addEdge(v - 1, v);
+    }
+    
+    auto [articulation_points, bridges] = analyzer.findCriticalElements();
+    
+    EXPECT_EQ(articulation_points.size(), n - 2);
+    EXPECT_EQ(bridges.size(), n - 1);
+}
+
+TEST(NetworkAnalyzerTest, WorkspaceReuseWithoutAllocations) {
+    NetworkAnalyzer analyzer(2000);
+    GraphGenerator generator(7);
+    generator.randomTree(2000, [&](int u, int v) { analyzer.addEdge(u + 1, v + 1); });
+    generator.erdosRenyi(2000, 1000, false, [&](int u, int v) { analyzer.addEdge(u + 1, v + 1); });
+    
+    ScratchWorkspace workspace;
+    auto first = analyzer.findCriticalElements(workspace);
+    auto second = analyzer.findCriticalElements(workspace);
+    size_t warm_allocations = workspace.getUpstreamAllocations();
+    auto third = analyzer.findCriticalElements(workspace);
+    
+    EXPECT_EQ(first, analyzer.findCriticalElements());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first, third);
+    EXPECT_EQ(workspace.getUpstreamAllocations(), warm_allocations);
+    
+    // С буферами ответа после прогрева куча не трогается вовсе
+    std::vector<int> articulation_points;
+    std::vector<std::pair<int, int>> bridges;
+    analyzer.findCriticalElements(workspace, articulation_points, bridges);
+    long long before = getHeapAllocations();
+    analyzer.findCriticalElements(workspace, articulation_points, bridges);
+    EXPECT_EQ(getHeapAllocations(), before);
+    analyzer.findCriticalElements(workspace);
+    EXPECT_GT(getHeapAllocations(), before);
+    EXPECT_EQ(articulation_points, first.first);
+    EXPECT_EQ(bridges, first.second);
+}
+
+// Параллельный поиск должен совпадать с последовательным при любом числе потоков
+TEST(NetworkAnalyzerTest, ParallelMatchesSequential) {
+    const int n = 30000;
+    NetworkAnalyzer analyzer(n);
+    GraphGenerator generator(11);
+    auto add = [&](int u, int v) { analyzer.addEdge(u + 1, v + 1); };
+    // Разреженный случайный граф: много мостов, деревьев-отростков и компонент
+    generator.erdosRenyi(n, n, false, add);
+    generator.grid(100, 100, add);
+    generator.randomTree(2000, add);
+    // Кратные рёбра и петли
+    analyzer.addEdge(1, 2);
+    analyzer.addEdge(1, 2);
+    analyzer.addEdge(5, 5);
+    
+    auto expected = analyzer.findCriticalElements();
+    ASSERT_FALSE(expected.first.empty());
+    ASSERT_FALSE(expected.second.empty());
+    for (int threads : {1, 2, 4, 8}) {
+        EXPECT_EQ(analyzer.findCriticalElementsParallel(threads), expected) << threads;
+    }
+}
+
+TEST(NetworkAnalyzerTest, ParallelHandlesSmallGraphs) {
+    // Две компоненты: треугольник с хвостом и одиночное ребро
+    NetworkAnalyzer analyzer(7);
+    analyzer.addEdge(1, 2);
+    analyzer.addEdge(2, 3);
+    analyzer.addEdge(3, 1);
+    analyzer.addEdge(3, 4);
+    analyzer.addEdge(4, 5);
+    analyzer.addEdge(6, 7);
+    analyzer.addEdge(6, 7);
+    
+    auto [articulation_points, bridges] = analyzer.findCriticalElementsParallel(4);
+    EXPECT_EQ(articulation_points, std::vector<int>({3, 4}));
+    EXPECT_EQ(bridges, (std::vector<std::pair<int, int>>{{3, 4}, {4, 5}, {6, 7}}));
+    EXPECT_EQ(analyzer.findCriticalElements(), analyzer.findCriticalElementsParallel(2));
+}
+
+// Связность u и v после удаления вершины x или ребра (a, b) обходом в ширину
+static bool bruteSeparated(int n, const std::vector<std::pair<int, int>>& edges,
+                           int u, int v, int x, std::pair<int, int> cut) {
+    if (u == x || v == x) return true;
+    std::vector<std::vector<int>> adjacency(n + 1);
+    for (const auto& [a, b] : edges) {
+        if (a == x || b == x) continue;
+        if (std::minmax(a, b) == std::minmax(cut.first, cut.second)) continue;
+        adjacency[a].push_back(b);
+        adjacency[b].push_back(a);
+    }
+    std::vector<bool> seen(n + 1, false);
+    std::vector<int> queue = {u};
+    seen[u] = true;
+    for (size_t i = 0; i < queue.size(); ++i) {
+        for (int w : adjacency[queue[i]]) {
+            if (!seen[w]) {
+                seen[w] = true;
+                queue.push_back(w);
+            }
+        }
+    }
+    return !seen[v];
+}
+
+TEST(BlockCutIndexTest, MatchesBruteForceOnRandomGraphs) {
+    for (int seed = 1; seed <= 20; ++seed) {
+        const int n = 14;
+        GraphGenerator generator(seed);
+        auto edges = GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+            generator.erdosRenyi(n, 12 + seed % 8, false, sink);
+        });
+        NetworkAnalyzer analyzer(n);
+        for (auto& [a, b] : edges) {
+            a++;
+            b++;
+            analyzer.addEdge(a, b);
+        }
+        BlockCutIndex index(analyzer);
+        
+        auto [articulation_points, bridges] = analyzer.findCriticalElements();
+        for (int x = 1; x <= n; ++x) {
+            bool expected = std::binary_search(articulation_points.begin(), articulation_points.end(), x);
+            EXPECT_EQ(index.isArticulationPoint(x), expected) << seed << " " << x;
+        }
+        for (const auto& [a, b] : edges) {
+            bool expected = std::binary_search(bridges.begin(), bridges.end(),
+                                               std::make_pair(std::min(a, b), std::max(a, b)));
+            EXPECT_EQ(index.isBridge(a, b), expected);
+            EXPECT_EQ(index.isBridge(b, a), expected);
+        }
+        
+        for (int u = 1; u <= n; ++u) {
+            for (int v = 1; v <= n; ++v) {
+                EXPECT_EQ(index.connected(u, v), !bruteSeparated(n, edges, u, v, 0, {0, 0}));
+                for (int x = 1; x <= n; ++x) {
+                    ASSERT_EQ(index.separatedByVertex(u, v, x),
+                              bruteSeparated(n, edges, u, v, x, {0, 0}))
+                        << "seed " << seed << ": " << u << " " << v << " without " << x;
+                }
+                for (const auto& [a, b] : edges) {
+                    ASSERT_EQ(index.separatedByEdge(u, v, a, b),
+                              bruteSeparated(n, edges, u, v, 0, {a, b}))
+                        << "seed " << seed << ": " << u << " " << v << " without " << a << "-" << b;
+                }
+            }
+        }
+    }
+}
+
+TEST(BlockCutIndexTest, BlocksAndTwoEdgeComponents) {
+    // Два треугольника 1-2-3 и 3-4-5, соединённые в 3, и мост 5-6
+    NetworkAnalyzer analyzer(6);
+    analyzer.addEdge(1, 2);
+    analyzer.addEdge(2, 3);
+    analyzer.addEdge(3, 1);
+    analyzer.addEdge(3, 4);
+    analyzer.addEdge(4, 5);
+    analyzer.addEdge(5, 3);
+    analyzer.addEdge(5, 6);
+    BlockCutIndex index(analyzer);
+    
+    EXPECT_EQ(index.getBlocksCount(), 3);
+    std::set<std::vector<int>> blocks;
+    for (int block = 0; block < index.getBlocksCount(); ++block) {
+        blocks.insert(index.getBlockVertices(block));
+    }
+    EXPECT_EQ(blocks, (std::set<std::vector<int>>{{1, 2, 3}, {3, 4, 5}, {5, 6}}));
+    
+    EXPECT_EQ(index.getTwoEdgeComponentsCount(), 2);
+    EXPECT_TRUE(index.twoEdgeConnected(1, 4));
+    EXPECT_FALSE(index.twoEdgeConnected(5, 6));
+    
+    EXPECT_TRUE(index.separatedByVertex(1, 4, 3));
+    EXPECT_FALSE(index.separatedByVertex(1, 2, 3));
+    EXPECT_TRUE(index.separatedByEdge(1, 6, 6, 5));
+    EXPECT_FALSE(index.separatedByEdge(1, 5, 3, 4));
+}
+
+// После каждой вставки множества совпадают с пересчётом с нуля
+TEST(IncrementalBiconnectivityTest, MatchesRecomputationAfterEachEdge) {
+    for (int seed = 1; seed <= 10; ++seed) {
+        const int n = 60;
+        SeededRandom random(seed);
+        NetworkAnalyzer incremental(n);
+        NetworkAnalyzer reference(n);
+        incremental.enableIncrementalMode();
+        
+        for (int step = 0; step < 150; ++step) {
+            int u = 1 + static_cast<int>(random.nextBelow(n));
+            // Чаще короткие рёбра, чтобы циклы появлялись постепенно
+            int v = step % 3 == 0 ? 1 + static_cast<int>(random.nextBelow(n))
+                                  : std::min(n, u + 1 + static_cast<int>(random.nextBelow(4)));
+            incremental.addEdge(u, v);
+            reference.addEdge(u, v);
+            
+            auto expected = reference.findCriticalElements();
+            ASSERT_EQ(incremental.findCriticalElements(), expected) << "seed " << seed << " step " << step;
+            const auto& state = incremental.getIncremental();
+            EXPECT_EQ(state.getArticulationPointsCount(), static_cast<int>(expected.first.size()));
+            EXPECT_EQ(state.getBridgesCount(), static_cast<int>(expected.second.size()));
+        }
+    }
+}
+
+TEST(IncrementalBiconnectivityTest, EnableOnExistingGraphAndQuery) {
+    NetworkAnalyzer analyzer(6);
+    analyzer.addEdge(1, 2);
+    analyzer.addEdge(2, 3);
+    analyzer.addEdge(3, 4);
+    analyzer.enableIncrementalMode();
+    
+    const auto& state = analyzer.getIncremental();
+    EXPECT_EQ(state.getBridgesCount(), 3);
+    EXPECT_TRUE(state.isArticulationPoint(2));
+    EXPECT_TRUE(state.isBridge(3, 2));
+    
+    // Цикл 1-2-3-4 и повтор ребра
+    analyzer.addEdge(4, 1);
+    analyzer.addEdge(4, 1);
+    EXPECT_EQ(state.getBridgesCount(), 0);
+    EXPECT_EQ(state.getArticulationPointsCount(), 0);
+    
+    // Хвост 4-5-6
+    analyzer.addEdge(5, 6);
+    analyzer.addEdge(4, 5);
+    EXPECT_TRUE(state.connected(1, 6));
+    EXPECT_EQ(state.getArticulationPoints(), std::vector<int>({4, 5}));
+    EXPECT_EQ(state.getBridges(), (std::vector<std::pair<int, int>>{{4, 5}, {5, 6}}));
+}
+
+// Два прохода по одному и тому же потоку рёбер дают ответ обычного DFS
+TEST(StreamingBiconnectivityTest, MatchesSequentialOnRandomGraphs) {
+    for (int seed = 1; seed <= 20; ++seed) {
+        const int n = 300;
+        SeededRandom random(seed);
+        std::vector<std::pair<int, int>> edges;
+        GraphGenerator generator(seed);
+        auto add = [&](int u, int v) { edges.push_back({u + 1, v + 1}); };
+        generator.erdosRenyi(n, n + static_cast<long long>(random.nextBelow(n)), false, add);
+        generator.randomTree(50, add);
+        // Кратные рёбра и петли
+        edges.push_back(edges.front());
+        edges.push_back({7, 7});
+        
+        NetworkAnalyzer analyzer(n);
+        StreamingBiconnectivity streaming(n);
+        for (const auto& [u, v] : edges) {
+            analyzer.addEdge(u, v);
+            streaming.scanForest(u, v);
+        }
+        streaming.finishForest();
+        for (const auto& [u, v] : edges) {
+            streaming.scanCertificate(u, v);
+        }
+        
+        auto expected = analyzer.findCriticalElements();
+        EXPECT_EQ(streaming.getArticulationPoints(), expected.first) << "seed " << seed;
+        EXPECT_EQ(streaming.getBridges(), expected.second) << "seed " << seed;
+    }
+}
+
+TEST(StreamingBiconnectivityTest, ReadsTextFileTwice) {
+    char path[] = "/tmp/streaming_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    // Два треугольника, соединённые мостом 3-4, и изолированная вершина 7
+    const char text[] = "7 7\n1 2\n2 3\n3 1\n3 4\n4 5\n5 6\n6 4\n";
+    ASSERT_EQ(write(fd, text, sizeof(text) - 1), static_cast<ssize_t>(sizeof(text) - 1));
+    close(fd);
+    
+    auto [articulation_points, bridges] = StreamingBiconnectivity::findInFile(path);
+    std::remove(path);
+    
+    EXPECT_EQ(articulation_points, std::vector<int>({3, 4}));
+    EXPECT_EQ(bridges, (std::vector<std::pair<int, int>>{{3, 4}}));
+}
+
+// Компоненты после отказов обходом графа, собранного заново
+static int bruteComponents(int n, const std::vector<std::pair<int, int>>& edges,
+                           const FailureScenario& scenario) {
+    std::vector<char> failed(n + 1, 0);
+    for (int x : scenario.routers) {
+        failed[x] = 1;
+    }
+    std::set<std::pair<int, int>> cut;
+    for (const auto& [a, b] : scenario.cables) {
+        cut.insert({std::min(a, b), std::max(a, b)});
+    }
+    Graph graph(n);
+    for (const auto& [u, v] : edges) {
+        if (!failed[u] && !failed[v] && !cut.count({std::min(u, v), std::max(u, v)})) {
+            graph.addEdge(u, v);
+        }
+    }
+    std::vector<char> seen(n + 1, 0);
+    int components = 0;
+    for (int s = 1; s <= n; ++s) {
+        if (failed[s] || seen[s]) {
+            continue;
+        }
+        components++;
+        std::vector<int> queue = {s};
+        seen[s] = 1;
+        for (std::size_t i = 0; i < queue.size(); ++i) {
+            for (int to : graph.getNeighbors(queue[i])) {
+                if (!seen[to]) {
+                    seen[to] = 1;
+                    queue.push_back(to);
+                }
+            }
+        }
+    }
+    return components;
+}
+
+TEST(FailureOracleTest, MatchesRebuildOnRandomScenarios) {
+    for (int seed = 1; seed <= 10; ++seed) {
+        const int n = 120;
+        SeededRandom random(seed);
+        std::vector<std::pair<int, int>> edges;
+        GraphGenerator generator(seed);
+        auto add = [&](int u, int v) { edges.push_back({u + 1, v + 1}); };
+        generator.erdosRenyi(n, n + 20 * seed, false, add);
+        generator.broom(30, 10, add);   // вершина большой степени
+        edges.push_back(edges.front());
+        edges.push_back({9, 9});
+        
+        NetworkAnalyzer analyzer(n);
+        for (const auto& [u, v] : edges) {
+            analyzer.addEdge(u, v);
+        }
+        FailureOracle oracle(analyzer);
+        EXPECT_EQ(oracle.getComponentsCount(), bruteComponents(n, edges, {}));
+        
+        std::vector<FailureScenario> scenarios(300);
+        for (FailureScenario& scenario : scenarios) {
+            int routers = static_cast<int>(random.nextBelow(4));
+            int cables = static_cast<int>(random.nextBelow(5));
+            for (int i = 0; i < routers; ++i) {
+                scenario.routers.push_back(1 + static_cast<int>(random.nextBelow(n)));
+            }
+            for (int i = 0; i < cables; ++i) {
+                scenario.cables.push_back(edges[random.nextBelow(edges.size())]);
+            }
+        }
+        // Несуществующий кабель и отказ вершины большой степени
+        scenarios.push_back({{}, {{1, 1000}}});
+        scenarios.push_back({{1}, {}});
+        
+        std::vector<int> expected;
+        for (const FailureScenario& scenario : scenarios) {
+            expected.push_back(bruteComponents(n, edges, scenario));
+        }
+        EXPECT_EQ(oracle.countComponentsBatch(scenarios), expected) << "seed " << seed;
+        EXPECT_EQ(analyzer.simulateFailures(scenarios, 4), expected) << "seed " << seed;
+    }
+}
+
+TEST(FailureOracleTest, TreeCablesAndRouters) {
+    // Цепочка 1-2-3-4-5, отдельная вершина 6
+    NetworkAnalyzer analyzer(6);
+    analyzer.addEdge(1, 2);
+    analyzer.addEdge(2, 3);
+    analyzer.addEdge(3, 4);
+    analyzer.addEdge(4, 5);
+    FailureOracle oracle(analyzer);
+    
+    EXPECT_EQ(oracle.getComponentsCount(), 2);
+    EXPECT_EQ(oracle.countComponents({{}, {{2, 3}, {4, 5}}}), 4);
+    EXPECT_EQ(oracle.countComponents({{3}, {}}), 3);
+    EXPECT_EQ(oracle.countComponents({{6}, {{3, 2}}}), 2);
+    EXPECT_EQ(oracle.countComponents({{1, 2, 3, 4, 5, 6}, {}}), 0);
+}
+
+TEST(GraphGeneratorTest, ErdosRenyiIsSimpleAndReproducible) {
+    GraphGenerator generator(42);
+    auto first = GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        generator.erdosRenyi(200, 1000, false, sink);
+    });
+    auto second = GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        generator.erdosRenyi(200, 1000, false, sink);
+    });
+    
+    EXPECT_EQ(first, second);
+    EXPECT_GT(first.size(), 800);
+    EXPECT_LT(first.size(), 1200);
+    
+    std::set<std::pair<int, int>> unique(first.begin(), first.end());
+    EXPECT_EQ(unique.size(), first.size());
+    for (const auto& [u, v] : first) {
+        EXPECT_LT(u, v);
+        EXPECT_LT(v, 200);
+    }
+}
+
+TEST(GraphGeneratorTest, BroomFeedsCriticalElements) {
+    GraphGenerator generator(1);
+    auto edges = GraphGenerator::collect([&](const GraphGenerator::EdgeSink& sink) {
+        generator.broom(10, 4, sink);
+    });
+    ASSERT_EQ(edges.size(), 9);
+    
+    NetworkAnalyzer analyzer(10);
+    for (const auto& [parent, child] : edges) {
+        EXPECT_LT(parent, child);
+        analyzer.addEdge(parent + 1, child + 1);
+    }
+    
+    // В дереве каждое ребро - мост, точки сочленения - вершины ручки, кроме первой
+    auto [articulation_points, bridges] = analyzer.findCriticalElements();
+    std::sort(articulation_points.begin(), articulation_points.end());
+    EXPECT_EQ(articulation_points, std::vector<int>({2, 3, 4}));
+    EXPECT_EQ(bridges.size(), 9);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,50 +1,108 @@
 #include "city_connector.hpp"
-#include <iostream>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "graph_file.hpp"
+#include "perf_stats.hpp"
+#include <unistd.h>
+#include <utility>
 #include <algorithm>
 
 CityConnector::CityConnector(int n) 
     : vertices_count(n), 
+      graph_dirty(true),
       components_count(0) {
     
-    graph.resize(n);
-    reversed_graph.resize(n);
     visited.assign(n, false);
     comp_id.assign(n, -1);
 }
 
+CityConnector::CityConnector(CsrGraph road_graph)
+    : vertices_count(road_graph.getVerticesCount()),
+      graph(std::move(road_graph)),
+      graph_dirty(false),
+      components_count(0) {
+    
+    visited.assign(vertices_count, false);
+    comp_id.assign(vertices_count, -1);
+}
+
 void CityConnector::addRoad(int from, int to) {
     int u = from - 1;
     int v = to - 1;
     
-    graph[u].push_back(v);
-    reversed_graph[v].push_back(u);
+    if (!graph_dirty && roads.empty()) {
+        // Граф задан готовым CSR: восстанавливаем список дорог перед изменением
+        roads = graph.toEdgeList();
+    }
+    roads.push_back({u, v});
+    graph_dirty = true;
+    
+    if (incremental) {
+        incremental->addEdge(u, v);
+    }
+}
+
+void CityConnector::enableIncrementalMode() {
+    if (graph_dirty) {
+        graph = CsrGraph::fromEdges(vertices_count, roads);
+        graph_dirty = false;
+    }
+    incremental = std::make_unique<IncrementalScc>(graph);
 }
 
 void CityConnector::dfsFirst(int v) {
-    visited[v] = true;
-    
-    for (int to : graph[v]) {
-        if (!visited[to]) {
-            dfsFirst(to);
+    // Порядок выхода по прямому графу
+    struct Visitor : DfsVisitor {
+        std::vector<bool>& visited;
+        std::vector<int>& order;
+        
+        void enter(int u, int) {
+            visited[u] = true;
         }
-    }
+        
+        DfsAction edge(int, int, int to, long long) {
+            return visited[to] ? DfsAction::Skip : DfsAction::Descend;
+        }
+        
+        void leave(int u, int) {
+            order.push_back(u);
+        }
+    };
     
-    order.push_back(v);
+    Visitor visitor{{}, visited, order};
+    dfs_engine.run(graph, v, visitor);
 }
 
 void CityConnector::dfsSecond(int v) {
-    visited[v] = true;
-    component.push_back(v);
-    comp_id[v] = components_count;
-    
-    for (int to : reversed_graph[v]) {
-        if (!visited[to]) {
-            dfsSecond(to);
+    // Сбор компоненты по обратному графу
+    struct Visitor : DfsVisitor {
+        std::vector<bool>& visited;
+        std::vector<int>& component;
+        std::vector<int>& comp_id;
+        int components_count;
+        
+        void enter(int u, int) {
+            visited[u] = true;
+            component.push_back(u);
+            comp_id[u] = components_count;
         }
-    }
+        
+        DfsAction edge(int, int, int to, long long) {
+            return visited[to] ? DfsAction::Skip : DfsAction::Descend;
+        }
+    };
+    
+    Visitor visitor{{}, visited, component, comp_id, components_count};
+    dfs_engine.run(reversed_graph, v, visitor);
 }
 
-void CityConnector::buildCondensedGraph() {
+void CityConnector::findComponentsKosaraju() {
+    {
+        PERF_PHASE("scc.reverse");
+        reversed_graph = graph.reversed();
+    }
+    PERF_PHASE("scc.kosaraju");
+    
     visited.assign(vertices_count, false);
     order.clear();
     
@@ -65,14 +123,122 @@ void CityConnector::buildCondensedGraph() {
             components_count++;
         }
     }
+    
+    // Обратный граф нужен только второму проходу
+    reversed_graph = CsrGraph();
 }
 
-int CityConnector::findMinRoadsToConnect() {
+int CityConnector::labelComponentsPearce(
+    const CsrGraph& source,
+    DfsEngine& engine,
+    std::vector<int>& rindex,
+    std::vector<bool>& root_candidate,
+    std::vector<int>& open
+) {
+    int n = source.getVerticesCount();
+    
+    // rindex = 0 - вершина не посещена
+    rindex.assign(n, 0);
+    root_candidate.assign(n, false);
+    open.clear();   // стек вершин, чьи компоненты ещё не закрыты
+    
+    struct Visitor : DfsVisitor {
+        std::vector<int>& rindex;
+        std::vector<bool>& root_candidate;
+        std::vector<int>& open;
+        int index = 1;
+        int next_component;
+        
+        void lower(int v, int w) {
+            if (rindex[w] < rindex[v]) {
+                rindex[v] = rindex[w];
+                root_candidate[v] = false;
+            }
+        }
+        
+        void enter(int v, int) {
+            rindex[v] = index++;
+            root_candidate[v] = true;
+        }
+        
+        DfsAction edge(int v, int, int to, long long) {
+            if (rindex[to] == 0) {
+                return DfsAction::Descend;
+            }
+            lower(v, to);
+            return DfsAction::Skip;
+        }
+        
+        void retreat(int v, int child, long long) {
+            lower(v, child);
+        }
+        
+        void leave(int v, int) {
+            if (!root_candidate[v]) {
+                open.push_back(v);
+                return;
+            }
+            // v - корень: снимаем со стека всю его компоненту
+            index--;
+            while (!open.empty() && rindex[v] <= rindex[open.back()]) {
+                rindex[open.back()] = next_component;
+                open.pop_back();
+                index--;
+            }
+            rindex[v] = next_component--;
+        }
+    };
+    
+    Visitor visitor{{}, rindex, root_candidate, open, 1, n - 1};
+    for (int v = 0; v < n; ++v) {
+        if (rindex[v] == 0) {
+            engine.run(source, v, visitor);
+        }
+    }
+    
+    // Номера n - 1, n - 2, ... переводим в 0, 1, ...
+    for (int& id : rindex) {
+        id = n - 1 - id;
+    }
+    return n - 1 - visitor.next_component;
+}
+
+void CityConnector::findComponentsPearce() {
+    PERF_PHASE("scc.pearce");
+    components_count = labelComponentsPearce(graph, dfs_engine, comp_id, root_candidate, order);
+}
+
+void CityConnector::buildCondensedGraph(SccAlgorithm algorithm, int threads) {
+    {
+        PERF_PHASE("scc.build");
+        if (graph_dirty) {
+            graph = CsrGraph::fromEdges(vertices_count, roads);
+            graph_dirty = false;
+        }
+    }
+    
+    switch (algorithm) {
+        case SccAlgorithm::Pearce:
+            findComponentsPearce();
+            break;
+        case SccAlgorithm::Kosaraju:
+            findComponentsKosaraju();
+            break;
+        case SccAlgorithm::Parallel:
+            findComponentsParallel(threads);
+            break;
+    }
+}
+
+int CityConnector::findMinRoadsToConnect(SccAlgorithm algorithm, int threads) {
     if (vertices_count <= 1) {
         return 0;
     }
+    if (incremental) {
+        return incremental->getMinRoadsToConnect();
+    }
     
-    buildCondensedGraph();
+    buildCondensedGraph(algorithm, threads);
     
     if (components_count == 1) {
         return 0;
@@ -82,7 +248,7 @@ int CityConnector::findMinRoadsToConnect() {
     std::vector<int> out_degree(components_count, 0);
     
     for (int u = 0; u < vertices_count; ++u) {
-        for (int v : graph[u]) {
+        for (int v : graph.getNeighbors(u)) {
             if (comp_id[u] != comp_id[v]) {
                 out_degree[comp_id[u]]++;
                 in_degree[comp_id[v]]++;
@@ -99,21 +265,40 @@ int CityConnector::findMinRoadsToConnect() {
     return std::max(sources, sinks);
 }
 
-void CityConnector::solveCityProblem() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+CityConnector CityConnector::readTextInput() {
+    PERF_PHASE("scc.read");
+    FastReader input;
     
-    int n, m;
-    std::cin >> n >> m;
+    int n = input.readInt();
+    int m = input.readInt();
     
     CityConnector connector(n);
     
     for (int i = 0; i < m; ++i) {
-        int a, b;
-        std::cin >> a >> b;
+        int a = input.readInt();
+        int b = input.readInt();
         connector.addRoad(a, b);
     }
     
+    return connector;
+}
+
+CityConnector CityConnector::readGraphFile() {
+    GraphFileHeader header;
+    CsrGraph graph = GraphFile::load(STDIN_FILENO, &header);
+    GraphFile::requireLayout(header, 0);
+    return CityConnector(std::move(graph));
+}
+
+void CityConnector::solveCityProblem() {
+    FastWriter output;
+    
+    // Бинарный файл графа (см. graph_convert) используется без разбора текста
+    CityConnector connector = GraphFile::isGraphFile(STDIN_FILENO)
+        ? readGraphFile()
+        : readTextInput();
+    
     int result = connector.findMinRoadsToConnect();
-    std::cout << result << "\n";
+    output.writeInt(result);
+    output.writeChar('\n');
 }
\ No newline at end of file
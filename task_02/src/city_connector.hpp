@@ -1,13 +1,27 @@
 #ifndef CITY_CONNECTOR_HPP
 #define CITY_CONNECTOR_HPP
 
+#include <memory>
 #include <vector>
+#include <utility>
+#include "csr_graph.hpp"
+#include "dfs_engine.hpp"
+#include "incremental_scc.hpp"
+
+// Алгоритм поиска компонент сильной связности
+enum class SccAlgorithm {
+    Pearce,     // один проход без обратного графа (по умолчанию)
+    Kosaraju,   // два прохода по прямому и обратному графу, для сравнения
+    Parallel    // многопоточный: отсечение, вперёд-назад и раскраска
+};
 
 class CityConnector {
 private:
     int vertices_count;
-    std::vector<std::vector<int>> graph;
-    std::vector<std::vector<int>> reversed_graph;
+    std::vector<std::pair<int, int>> roads;
+    CsrGraph graph;
+    CsrGraph reversed_graph;
+    bool graph_dirty;
     
     std::vector<bool> visited;
     std::vector<int> order;
@@ -16,16 +30,73 @@ private:
     std::vector<int> comp_id;
     int components_count;
     
+    // У Пирса: вершина пока может быть корнем своей компоненты
+    std::vector<bool> root_candidate;
+    
+    DfsEngine dfs_engine;
+    
+    // Поддерживаемые при добавлении дорог компоненты и истоки/стоки
+    std::unique_ptr<IncrementalScc> incremental;
+    
+    // Обходы Косарайю на явном стеке
     void dfsFirst(int v);
     void dfsSecond(int v);
-    void buildCondensedGraph();
+    void findComponentsKosaraju();
+    
+    void findComponentsPearce();
+    
+    // Многопоточный поиск (parallel_scc.cpp); threads <= 0 - по числу ядер
+    void findComponentsParallel(int threads);
+    
+    void buildCondensedGraph(SccAlgorithm algorithm, int threads);
+    
+    static CityConnector readTextInput();
+    // Бинарный файл графа (см. graph_convert)
+    static CityConnector readGraphFile();
     
 public:
     CityConnector(int n);
+    // Готовый ориентированный CSR (например, из бинарного файла)
+    explicit CityConnector(CsrGraph road_graph);
     
     void addRoad(int from, int to);
     
-    int findMinRoadsToConnect();
+    // Инкрементальный режим: дальнейшие addRoad обновляют компоненты и
+    // число истоков и стоков конденсации, а findMinRoadsToConnect()
+    // отвечает без пересчёта. Включение стоит одного прохода Пирса
+    void enableIncrementalMode();
+    bool isIncremental() const { return incremental != nullptr; }
+    // Текущее состояние; только в инкрементальном режиме
+    const IncrementalScc& getIncremental() const { return *incremental; }
+    
+    // Пирс: одно число rindex на вершину (хранится прямо в comp_id), бит
+    // root_candidate и стек вершин открытых компонент. Завершённые
+    // компоненты получают номера n - 1, n - 2, ..., которые больше любого
+    // rindex ещё открытой вершины, поэтому отдельный флаг «в стеке» не нужен.
+    // Возвращает число компонент, номера в component - 0, 1, ...
+    static int labelComponentsPearce(
+        const CsrGraph& source,
+        DfsEngine& engine,
+        std::vector<int>& component,
+        std::vector<bool>& root_candidate,
+        std::vector<int>& open
+    );
+    
+    // threads учитывается только в SccAlgorithm::Parallel; в инкрементальном
+    // режиме алгоритм не используется
+    int findMinRoadsToConnect(SccAlgorithm algorithm = SccAlgorithm::Pearce, int threads = 0);
+    
+    // Сами дороги (с 1), после которых город сильно связен: их ровно
+    // findMinRoadsToConnect(), время и память O(n + m) (road_augmentation.cpp)
+    std::vector<std::pair<int, int>> findRoadsToConnect(
+        SccAlgorithm algorithm = SccAlgorithm::Pearce,
+        int threads = 0
+    );
+    
+    // Число компонент и номер компоненты каждой вершины (с 0) после
+    // последнего findMinRoadsToConnect; нумерация зависит от алгоритма
+    int getComponentsCount() const { return components_count; }
+    const std::vector<int>& getComponentIds() const { return comp_id; }
     
     static void solveCityProblem();
 };
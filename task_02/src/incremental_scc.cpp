@@ -0,0 +1,251 @@
+#include "incremental_scc.hpp"
+#include "city_connector.hpp"
+#include "perf_stats.hpp"
+#include <algorithm>
+#include <numeric>
+
+IncrementalScc::IncrementalScc(int n)
+    : vertices_count(n),
+      components_count(n),
+      sources_count(n),
+      sinks_count(n),
+      link(n),
+      size(n, 1),
+      ord(n),
+      out_arcs(n),
+      in_arcs(n),
+      stamp(0),
+      in_forward(n, 0),
+      in_backward(n, 0) {
+    std::iota(link.begin(), link.end(), 0);
+    std::iota(ord.begin(), ord.end(), 0);
+}
+
+IncrementalScc::IncrementalScc(const CsrGraph& graph)
+    : IncrementalScc(graph.getVerticesCount()) {
+    PERF_PHASE("scc.incremental.build");
+    std::vector<int> component;
+    std::vector<bool> root_candidate;
+    DfsEngine engine;
+    components_count = CityConnector::labelComponentsPearce(
+        graph, engine, component, root_candidate, stack);
+    stack.clear();
+
+    // Представитель компоненты - её первая вершина. Пирс нумерует
+    // компоненты в порядке закрытия, то есть от стоков к истокам
+    std::vector<int> leader(components_count, -1);
+    for (int v = 0; v < vertices_count; ++v) {
+        int& head = leader[component[v]];
+        if (head == -1) {
+            head = v;
+            ord[v] = components_count - 1 - component[v];
+        } else {
+            link[v] = head;
+            size[head]++;
+        }
+    }
+
+    for (int u = 0; u < vertices_count; ++u) {
+        int cu = leader[component[u]];
+        for (int v : graph.getNeighbors(u)) {
+            int cv = leader[component[v]];
+            if (cu != cv) {
+                out_arcs[cu].push_back(v);
+                in_arcs[cv].push_back(u);
+            }
+        }
+    }
+
+    sources_count = 0;
+    sinks_count = 0;
+    for (int c : leader) {
+        countEnds(c, 1);
+    }
+}
+
+int IncrementalScc::find(int v) {
+    while (link[v] != v) {
+        link[v] = link[link[v]];
+        v = link[v];
+    }
+    return v;
+}
+
+void IncrementalScc::countEnds(int c, int sign) {
+    if (in_arcs[c].empty()) {
+        sources_count += sign;
+    }
+    if (out_arcs[c].empty()) {
+        sinks_count += sign;
+    }
+}
+
+void IncrementalScc::addArc(int cu, int cv, int u, int v) {
+    countEnds(cu, -1);
+    countEnds(cv, -1);
+    out_arcs[cu].push_back(v);
+    in_arcs[cv].push_back(u);
+    countEnds(cu, 1);
+    countEnds(cv, 1);
+}
+
+bool IncrementalScc::searchForward(int start, int upper, int target) {
+    bool reached = false;
+    forward_set.clear();
+    stack.assign(1, start);
+    in_forward[start] = stamp;
+    while (!stack.empty()) {
+        int c = stack.back();
+        stack.pop_back();
+        forward_set.push_back(c);
+        if (c == target) {
+            // Дальше target идти незачем: всё за ним имеет ord > upper
+            reached = true;
+            continue;
+        }
+        for (int v : out_arcs[c]) {
+            int w = find(v);
+            if (in_forward[w] != stamp && ord[w] <= upper) {
+                in_forward[w] = stamp;
+                stack.push_back(w);
+            }
+        }
+    }
+    return reached;
+}
+
+void IncrementalScc::searchBackward(int start, int lower) {
+    backward_set.clear();
+    stack.assign(1, start);
+    in_backward[start] = stamp;
+    while (!stack.empty()) {
+        int c = stack.back();
+        stack.pop_back();
+        backward_set.push_back(c);
+        for (int u : in_arcs[c]) {
+            int w = find(u);
+            if (in_backward[w] != stamp && ord[w] >= lower) {
+                in_backward[w] = stamp;
+                stack.push_back(w);
+            }
+        }
+    }
+}
+
+int IncrementalScc::merge(const std::vector<int>& members) {
+    PERF_COUNT_ADD("scc.incremental.merged", members.size() - 1);
+    int root = members[0];
+    for (int c : members) {
+        countEnds(c, -1);
+        if (size[c] > size[root]) {
+            root = c;
+        }
+    }
+
+    // Списки сливаются в самый длинный; дуги между членами становятся
+    // внутренними и выбрасываются, так что в списках только внешние дуги
+    auto absorb = [&](std::vector<std::vector<int>>& arcs) {
+        int longest = root;
+        for (int c : members) {
+            if (arcs[c].size() > arcs[longest].size()) {
+                longest = c;
+            }
+        }
+        std::vector<int> merged = std::move(arcs[longest]);
+        for (int c : members) {
+            if (c != longest) {
+                merged.insert(merged.end(), arcs[c].begin(), arcs[c].end());
+                std::vector<int>().swap(arcs[c]);
+            }
+        }
+        std::erase_if(merged, [&](int v) {
+            int w = find(v);
+            return in_forward[w] == stamp && in_backward[w] == stamp;
+        });
+        arcs[root] = std::move(merged);
+    };
+    absorb(out_arcs);
+    absorb(in_arcs);
+
+    for (int c : members) {
+        if (c != root) {
+            link[c] = root;
+            size[root] += size[c];
+        }
+    }
+    components_count -= static_cast<int>(members.size()) - 1;
+    countEnds(root, 1);
+    return root;
+}
+
+void IncrementalScc::addEdge(int u, int v) {
+    int cu = find(u);
+    int cv = find(v);
+    if (cu == cv) {
+        return;
+    }
+    addArc(cu, cv, u, v);
+    if (ord[cu] < ord[cv]) {
+        return;
+    }
+
+    PERF_COUNT("scc.incremental.reorders");
+    int lower = ord[cv];
+    int upper = ord[cu];
+    stamp++;
+    bool cycle = searchForward(cv, upper, cu);
+    searchBackward(cu, lower);
+
+    // Свободные позиции - прежние ord всех затронутых компонент
+    positions.clear();
+    for (int c : forward_set) {
+        positions.push_back(ord[c]);
+    }
+    for (int c : backward_set) {
+        if (in_forward[c] != stamp) {
+            positions.push_back(ord[c]);
+        }
+    }
+    std::sort(positions.begin(), positions.end());
+
+    auto by_ord = [&](int a, int b) { return ord[a] < ord[b]; };
+    int merged = -1;
+    if (cycle) {
+        // В цикле ровно те, кто достижим из cv и достигает cu
+        std::vector<int> members;
+        for (int c : forward_set) {
+            if (in_backward[c] == stamp) {
+                members.push_back(c);
+            }
+        }
+        auto in_cycle = [&](int c) {
+            return in_forward[c] == stamp && in_backward[c] == stamp;
+        };
+        merged = merge(members);
+        std::erase_if(forward_set, in_cycle);
+        std::erase_if(backward_set, in_cycle);
+    }
+    std::sort(forward_set.begin(), forward_set.end(), by_ord);
+    std::sort(backward_set.begin(), backward_set.end(), by_ord);
+
+    // B в начало отрезка, F в конец, слитая компонента между ними:
+    // F только поднимается, B только опускается
+    std::size_t slot = 0;
+    for (int c : backward_set) {
+        ord[c] = positions[slot++];
+    }
+    if (merged != -1) {
+        ord[merged] = positions[slot];
+    }
+    slot = positions.size() - forward_set.size();
+    for (int c : forward_set) {
+        ord[c] = positions[slot++];
+    }
+}
+
+int IncrementalScc::getMinRoadsToConnect() const {
+    if (vertices_count <= 1 || components_count == 1) {
+        return 0;
+    }
+    return std::max(sources_count, sinks_count);
+}
@@ -0,0 +1,76 @@
+#ifndef INCREMENTAL_SCC_HPP
+#define INCREMENTAL_SCC_HPP
+
+#include <vector>
+#include "csr_graph.hpp"
+
+// Компоненты сильной связности и число истоков/стоков конденсации при
+// добавлении дуг, без пересчёта с нуля. Вершины с 0, как внутри CityConnector.
+//
+// Компоненты - система непересекающихся множеств, конденсация хранится
+// списками дуг (концы - вершины, компонента находится через find) и
+// топологическим порядком ord по Пирсу - Келли. Дуга cu -> cv с
+// ord[cu] < ord[cv] порядок не нарушает. Иначе ищутся F - достижимые из cv
+// с ord <= ord[cu] и B - достигающие cu с ord >= ord[cv]. Если F и B
+// пересеклись, дуга замкнула цикл: F ∩ B сливается в одну компоненту.
+// Затем B, слитая компонента и F получают те же позиции ord в этом порядке.
+// Работа пропорциональна затронутому отрезку порядка, а не всему графу.
+class IncrementalScc {
+private:
+    int vertices_count;
+    int components_count;
+    int sources_count;
+    int sinks_count;
+
+    std::vector<int> link;
+    std::vector<int> size;
+
+    // По представителю компоненты: позиция в порядке и концы внешних дуг
+    // наружу и внутрь (с кратностью), пустой список - исток или сток
+    std::vector<int> ord;
+    std::vector<std::vector<int>> out_arcs;
+    std::vector<std::vector<int>> in_arcs;
+
+    // Метки обходов: совпадение со stamp - «в текущем проходе»
+    unsigned stamp;
+    std::vector<unsigned> in_forward;
+    std::vector<unsigned> in_backward;
+    std::vector<int> forward_set;
+    std::vector<int> backward_set;
+    std::vector<int> stack;
+    std::vector<int> positions;
+
+    int find(int v);
+
+    // Вклад компоненты c в число истоков и стоков
+    void countEnds(int c, int sign);
+
+    // Дуга между разными компонентами (уже учтённая в списках)
+    void addArc(int cu, int cv, int u, int v);
+
+    // Обходы Пирса - Келли; true, если прямой обход дошёл до target
+    bool searchForward(int start, int upper, int target);
+    void searchBackward(int start, int lower);
+
+    // Сливает members (не менее двух) в одну компоненту и возвращает её
+    int merge(const std::vector<int>& members);
+
+public:
+    // n вершин без дуг
+    explicit IncrementalScc(int n);
+    // Начальное состояние по готовому графу за O(n + m)
+    explicit IncrementalScc(const CsrGraph& graph);
+
+    void addEdge(int u, int v);
+
+    bool sameComponent(int u, int v) { return find(u) == find(v); }
+
+    int getComponentsCount() const { return components_count; }
+    int getSourcesCount() const { return sources_count; }
+    int getSinksCount() const { return sinks_count; }
+
+    // Ответ задачи: сколько дорог добавить до сильной связности
+    int getMinRoadsToConnect() const;
+};
+
+#endif
@@ -1,6 +1,14 @@
 #include "city_connector.hpp"
+#include <cstdio>
+#include <exception>
 
 int main() {
-    CityConnector::solveCityProblem();
+    // Повреждённый или чужой бинарный граф (GraphFile) - сообщение, а не abort
+    try {
+        CityConnector::solveCityProblem();
+    } catch (const std::exception& error) {
+        std::fprintf(stderr, "task_02: %s\n", error.what());
+        return 1;
+    }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,431 @@
+#include "city_connector.hpp"
+#include "perf_stats.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+
+// Многопоточный поиск компонент сильной связности по схеме Multistep
+// (Slota, Rajamanickam, Madduri):
+//
+// 1. Отсечение: вершина без живых входящих или исходящих дуг - отдельная
+//    компонента. Отсечённые уменьшают степени соседей, так что цепочки
+//    снимаются волнами за O(m) суммарно. Затем отсекаются пары u <-> v,
+//    у которых нет других входящих (или исходящих) дуг.
+// 2. Вперёд-назад от вершины с наибольшим произведением степеней: в
+//    степенных графах она почти наверняка в гигантской компоненте, и та
+//    снимается двумя параллельными обходами в ширину.
+// 3. Раскраска: каждая вершина получает максимум номеров, из которых она
+//    достижима. Вершина, сохранившая свой цвет, - корень; её компонента -
+//    вершины того же цвета, из которых она достижима. Корни разбираются
+//    параллельно, каждый своим потоком.
+// 4. Когда живых вершин остаётся мало, остаток доделывает Пирс.
+//
+// Номера компонент зависят от расписания потоков, само разбиение - нет.
+
+namespace {
+
+constexpr std::size_t kGrain = 1024;
+
+// Остаток меньше - последовательный Пирс на индуцированном подграфе
+constexpr std::size_t kSerialCutoff = 1 << 14;
+
+class ParallelScc {
+private:
+    const CsrGraph& forward;
+    const CsrGraph& backward;
+    ThreadPool& pool;
+    std::vector<int>& component;
+
+    int n;
+    std::atomic<int> next_component;
+
+    // done[v] - вершина уже в какой-то компоненте (доступ через atomic_ref)
+    std::vector<char> done;
+    std::vector<int> alive;
+    std::vector<int> in_degree;
+    std::vector<int> out_degree;
+    std::vector<int> mark;
+    int stamp;
+    std::vector<std::vector<int>> local;
+
+    bool isDone(int v) const {
+        return std::atomic_ref<const char>(done[v]).load(std::memory_order_relaxed) != 0;
+    }
+
+    // true, если v удалось забрать в компоненту id
+    bool claim(int v, int id) {
+        if (std::atomic_ref<char>(done[v]).exchange(1, std::memory_order_relaxed) != 0) {
+            return false;
+        }
+        component[v] = id;
+        return true;
+    }
+
+    // Забирает v в новую одиночную компоненту; номер тратится только при успехе
+    bool claimSingle(int v) {
+        if (std::atomic_ref<char>(done[v]).exchange(1, std::memory_order_relaxed) != 0) {
+            return false;
+        }
+        component[v] = next_component++;
+        return true;
+    }
+
+    bool claimMark(int v) {
+        std::atomic_ref<int> slot(mark[v]);
+        int old = slot.load(std::memory_order_relaxed);
+        return old != stamp && slot.compare_exchange_strong(old, stamp, std::memory_order_relaxed);
+    }
+
+    // Собирает потоковые списки в один
+    void gather(std::vector<int>& target) {
+        target.clear();
+        for (std::vector<int>& part : local) {
+            target.insert(target.end(), part.begin(), part.end());
+            part.clear();
+        }
+    }
+
+    // Оставляет в alive только вершины без компоненты
+    void compact() {
+        pool.parallelFor(0, alive.size(), kGrain, [&](std::size_t from, std::size_t to, int thread) {
+            for (std::size_t i = from; i < to; ++i) {
+                if (!isDone(alive[i])) {
+                    local[thread].push_back(alive[i]);
+                }
+            }
+        });
+        gather(alive);
+    }
+
+    // Живые соседи без петли
+    int countAlive(const CsrGraph& graph, int v) const {
+        int count = 0;
+        for (int w : graph.getNeighbors(v)) {
+            count += w != v && !isDone(w);
+        }
+        return count;
+    }
+
+    // Единственный живой сосед v или -1
+    int onlyAlive(const CsrGraph& graph, int v) const {
+        for (int w : graph.getNeighbors(v)) {
+            if (w != v && !isDone(w)) {
+                return w;
+            }
+        }
+        return -1;
+    }
+
+    // Обход в ширину из source по живым вершинам, разрешённым allowed;
+    // посещённые помечаются текущим stamp и складываются в visited
+    template <typename Allowed>
+    void parallelBfs(const CsrGraph& graph, int source, Allowed&& allowed,
+                     std::vector<int>& visited) {
+        visited.assign(1, source);
+        mark[source] = stamp;
+        std::size_t begin = 0;
+        while (begin < visited.size()) {
+            std::size_t end = visited.size();
+            pool.parallelFor(begin, end, kGrain, [&](std::size_t from, std::size_t to, int thread) {
+                for (std::size_t i = from; i < to; ++i) {
+                    for (int w : graph.getNeighbors(visited[i])) {
+                        if (!isDone(w) && allowed(w) && claimMark(w)) {
+                            local[thread].push_back(w);
+                        }
+                    }
+                }
+            });
+            for (std::vector<int>& part : local) {
+                visited.insert(visited.end(), part.begin(), part.end());
+                part.clear();
+            }
+            begin = end;
+        }
+    }
+
+public:
+    ParallelScc(const CsrGraph& graph, const CsrGraph& reversed, ThreadPool& thread_pool,
+                std::vector<int>& result)
+        : forward(graph),
+          backward(reversed),
+          pool(thread_pool),
+          component(result),
+          n(graph.getVerticesCount()),
+          next_component(0),
+          done(n, 0),
+          alive(n),
+          in_degree(n, 0),
+          out_degree(n, 0),
+          mark(n, 0),
+          stamp(0),
+          local(thread_pool.getThreadsCount()) {
+        component.assign(n, -1);
+        for (int v = 0; v < n; ++v) {
+            alive[v] = v;
+        }
+    }
+
+    int getComponentsCount() const { return next_component.load(); }
+    std::size_t getAliveCount() const { return alive.size(); }
+
+    // Отсечение одиночных компонент волнами до неподвижной точки
+    void trim() {
+        PERF_PHASE("scc.parallel.trim");
+        pool.parallelFor(0, alive.size(), kGrain, [&](std::size_t from, std::size_t to, int) {
+            for (std::size_t i = from; i < to; ++i) {
+                int v = alive[i];
+                in_degree[v] = countAlive(backward, v);
+                out_degree[v] = countAlive(forward, v);
+            }
+        });
+        pool.parallelFor(0, alive.size(), kGrain, [&](std::size_t from, std::size_t to, int thread) {
+            for (std::size_t i = from; i < to; ++i) {
+                int v = alive[i];
+                if ((in_degree[v] == 0 || out_degree[v] == 0) && claimSingle(v)) {
+                    local[thread].push_back(v);
+                }
+            }
+        });
+
+        std::vector<int> wave;
+        gather(wave);
+        while (!wave.empty()) {
+            PERF_COUNT_ADD("scc.parallel.trimmed", wave.size());
+            pool.parallelFor(0, wave.size(), kGrain, [&](std::size_t from, std::size_t to, int thread) {
+                auto release = [&](int w, std::vector<int>& degree) {
+                    if (std::atomic_ref<int>(degree[w]).fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                        claimSingle(w)) {
+                        local[thread].push_back(w);
+                    }
+                };
+                for (std::size_t i = from; i < to; ++i) {
+                    int v = wave[i];
+                    for (int w : forward.getNeighbors(v)) {
+                        if (w != v && !isDone(w)) {
+                            release(w, in_degree);
+                        }
+                    }
+                    for (int u : backward.getNeighbors(v)) {
+                        if (u != v && !isDone(u)) {
+                            release(u, out_degree);
+                        }
+                    }
+                }
+            });
+            gather(wave);
+        }
+        compact();
+    }
+
+    // Пары u <-> v без других входящих или без других исходящих дуг.
+    // Степени берутся из последнего trim()
+    void trimPairs() {
+        PERF_PHASE("scc.parallel.trim_pairs");
+        pool.parallelFor(0, alive.size(), kGrain, [&](std::size_t from, std::size_t to, int) {
+            for (std::size_t i = from; i < to; ++i) {
+                int v = alive[i];
+                for (int side = 0; side < 2; ++side) {
+                    const CsrGraph& graph = side == 0 ? backward : forward;
+                    const std::vector<int>& degree = side == 0 ? in_degree : out_degree;
+                    if (degree[v] != 1) {
+                        continue;
+                    }
+                    int u = onlyAlive(graph, v);
+                    // Пару забирает меньшая вершина, второй раз её не увидят
+                    if (u > v && degree[u] == 1 && onlyAlive(graph, u) == v) {
+                        int id = next_component++;
+                        claim(v, id);
+                        claim(u, id);
+                        break;
+                    }
+                }
+            }
+        });
+        compact();
+    }
+
+    // Вперёд-назад от вершины с наибольшим произведением степеней
+    void forwardBackward() {
+        PERF_PHASE("scc.parallel.forward_backward");
+        if (alive.empty()) {
+            return;
+        }
+        std::vector<long long> best_score(pool.getThreadsCount(), -1);
+        std::vector<int> best_vertex(pool.getThreadsCount(), -1);
+        pool.parallelFor(0, alive.size(), kGrain, [&](std::size_t from, std::size_t to, int thread) {
+            for (std::size_t i = from; i < to; ++i) {
+                int v = alive[i];
+                long long score = static_cast<long long>(in_degree[v] + 1) * (out_degree[v] + 1);
+                if (score > best_score[thread]) {
+                    best_score[thread] = score;
+                    best_vertex[thread] = v;
+                }
+            }
+        });
+        int pivot = best_vertex[std::max_element(best_score.begin(), best_score.end()) -
+                                best_score.begin()];
+
+        std::vector<int> reached;
+        ++stamp;
+        parallelBfs(forward, pivot, [](int) { return true; }, reached);
+
+        // Обратный обход внутри прямого: путь в pivot из достижимой
+        // вершины целиком лежит в достижимых
+        int forward_stamp = stamp;
+        ++stamp;
+        auto in_forward = [&](int w) {
+            return std::atomic_ref<int>(mark[w]).load(std::memory_order_relaxed) >= forward_stamp;
+        };
+        std::vector<int> both;
+        parallelBfs(backward, pivot, in_forward, both);
+
+        int id = next_component++;
+        pool.parallelFor(0, both.size(), kGrain, [&](std::size_t from, std::size_t to, int) {
+            for (std::size_t i = from; i < to; ++i) {
+                claim(both[i], id);
+            }
+        });
+        compact();
+    }
+
+    // Раунд раскраски: снимает хотя бы компоненту с наибольшим номером
+    void coloring() {
+        PERF_PHASE("scc.parallel.coloring");
+        std::vector<int>& color = in_degree;   // степени пересчитает следующий trim()
+
+        pool.parallelFor(0, alive.size(), kGrain, [&](std::size_t from, std::size_t to, int) {
+            for (std::size_t i = from; i < to; ++i) {
+                color[alive[i]] = alive[i];
+            }
+        });
+
+        // Волна - вершины, чей цвет изменился; повтор в волне отсекает stamp
+        std::vector<int> wave = alive;
+        while (!wave.empty()) {
+            ++stamp;
+            pool.parallelFor(0, wave.size(), kGrain, [&](std::size_t from, std::size_t to, int thread) {
+                for (std::size_t i = from; i < to; ++i) {
+                    int v = wave[i];
+                    int c = std::atomic_ref<int>(color[v]).load(std::memory_order_relaxed);
+                    for (int w : forward.getNeighbors(v)) {
+                        if (isDone(w)) {
+                            continue;
+                        }
+                        std::atomic_ref<int> slot(color[w]);
+                        int current = slot.load(std::memory_order_relaxed);
+                        bool raised = false;
+                        while (current < c) {
+                            if (slot.compare_exchange_weak(current, c, std::memory_order_relaxed)) {
+                                raised = true;
+                                break;
+                            }
+                        }
+                        if (raised && claimMark(w)) {
+                            local[thread].push_back(w);
+                        }
+                    }
+                }
+            });
+            gather(wave);
+        }
+
+        // Корни разбираются параллельно: множества цветов не пересекаются
+        std::vector<int> roots;
+        pool.parallelFor(0, alive.size(), kGrain, [&](std::size_t from, std::size_t to, int thread) {
+            for (std::size_t i = from; i < to; ++i) {
+                if (color[alive[i]] == alive[i]) {
+                    local[thread].push_back(alive[i]);
+                }
+            }
+        });
+        gather(roots);
+
+        std::vector<std::vector<int>> queues(pool.getThreadsCount());
+        pool.parallelFor(0, roots.size(), 1, [&](std::size_t from, std::size_t to, int thread) {
+            std::vector<int>& queue = queues[thread];
+            for (std::size_t i = from; i < to; ++i) {
+                int root = roots[i];
+                int id = next_component++;
+                claim(root, id);
+                queue.assign(1, root);
+                for (std::size_t head = 0; head < queue.size(); ++head) {
+                    for (int u : backward.getNeighbors(queue[head])) {
+                        if (color[u] == root && claim(u, id)) {
+                            queue.push_back(u);
+                        }
+                    }
+                }
+            }
+        });
+        compact();
+    }
+
+    // Остаток - Пирсом на индуцированном подграфе
+    void finishSerial() {
+        PERF_PHASE("scc.parallel.serial");
+        if (alive.empty()) {
+            return;
+        }
+        std::vector<int>& local_index = in_degree;
+        for (std::size_t i = 0; i < alive.size(); ++i) {
+            local_index[alive[i]] = static_cast<int>(i);
+        }
+        std::vector<std::pair<int, int>> edges;
+        for (int v : alive) {
+            for (int w : forward.getNeighbors(v)) {
+                if (!done[w]) {
+                    edges.push_back({local_index[v], local_index[w]});
+                }
+            }
+        }
+        CsrGraph rest = CsrGraph::fromEdges(static_cast<int>(alive.size()), edges);
+
+        DfsEngine engine;
+        std::vector<int> rest_component;
+        std::vector<bool> root_candidate;
+        std::vector<int> open;
+        int count = CityConnector::labelComponentsPearce(rest, engine, rest_component,
+                                                         root_candidate, open);
+        int base = next_component.fetch_add(count);
+        for (std::size_t i = 0; i < alive.size(); ++i) {
+            claim(alive[i], base + rest_component[i]);
+        }
+        alive.clear();
+    }
+};
+
+}
+
+void CityConnector::findComponentsParallel(int threads) {
+    ThreadPool pool(threads);
+    // На одном потоке накладные расходы не окупаются
+    if (pool.getThreadsCount() == 1) {
+        findComponentsPearce();
+        return;
+    }
+    
+    CsrGraph reversed;
+    {
+        PERF_PHASE("scc.reverse");
+        reversed = graph.reversed();
+    }
+    PERF_PHASE("scc.parallel");
+    ParallelScc scc(graph, reversed, pool, comp_id);
+
+    scc.trim();
+    scc.trimPairs();
+    scc.forwardBackward();
+    scc.trim();
+    // Раунд, снявший мало вершин, означает длинную цепочку компонент -
+    // её быстрее пройти последовательно
+    while (scc.getAliveCount() > kSerialCutoff) {
+        std::size_t before = scc.getAliveCount();
+        scc.coloring();
+        scc.trim();
+        if (scc.getAliveCount() > before - before / 64) {
+            break;
+        }
+    }
+    scc.finishSerial();
+    components_count = scc.getComponentsCount();
+}
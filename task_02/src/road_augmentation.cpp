@@ -0,0 +1,166 @@
+#include "city_connector.hpp"
+#include "perf_stats.hpp"
+
+// Сами дороги по Эсварану - Тарьяну. Истоки и стоки конденсации
+// разбиваются на пары (s_i, t_i), где t_i достижим из s_i: жадно, поиском в
+// глубину из каждого истока до первого ещё не занятого стока, причём
+// пройденные компоненты помечаются раз и навсегда - весь подбор за O(n + m).
+// Если истоков не больше, чем стоков (S <= T), а пар p, добавляются
+//   t_i -> s_{i+1} при i < p - пары сцепляются в кольцо,
+//   t_i -> s_i при p < i <= S - свободные истоки к свободным стокам,
+//   t_p -> t_{S+1} -> ... -> t_T -> s_1 - лишние стоки вставляются в кольцо
+//   (при S = T просто t_p -> s_1).
+// Всего max(S, T) дорог. При S > T то же строится для обратного графа.
+// Изолированная компонента - одновременно исток и сток, пара сама себе.
+//
+// Конденсированный граф не строится: компоненты обходятся через списки
+// своих вершин, так что кроме графа нужны O(n) памяти.
+
+namespace {
+
+enum ComponentFlags : unsigned char {
+    kHasIn = 1,
+    kHasOut = 2,
+    kVisited = 4,
+    kMatched = 8
+};
+
+}  // namespace
+
+std::vector<std::pair<int, int>> CityConnector::findRoadsToConnect(
+    SccAlgorithm algorithm,
+    int threads
+) {
+    if (vertices_count <= 1) {
+        return {};
+    }
+    buildCondensedGraph(algorithm, threads);
+    if (components_count == 1) {
+        return {};
+    }
+    PERF_PHASE("scc.augment");
+    int k = components_count;
+
+    // Вершины, сгруппированные по компонентам (сортировка подсчётом)
+    std::vector<int> first(k + 1, 0);
+    for (int v = 0; v < vertices_count; ++v) {
+        first[comp_id[v] + 1]++;
+    }
+    for (int c = 0; c < k; ++c) {
+        first[c + 1] += first[c];
+    }
+    std::vector<int> members(vertices_count);
+    {
+        std::vector<int> cursor(first.begin(), first.end() - 1);
+        for (int v = 0; v < vertices_count; ++v) {
+            members[cursor[comp_id[v]]++] = v;
+        }
+    }
+
+    std::vector<unsigned char> flags(k, 0);
+    for (int u = 0; u < vertices_count; ++u) {
+        for (int v : graph.getNeighbors(u)) {
+            if (comp_id[u] != comp_id[v]) {
+                flags[comp_id[u]] |= kHasOut;
+                flags[comp_id[v]] |= kHasIn;
+            }
+        }
+    }
+
+    // Поиск свободного стока из истока source; -1, если его нет
+    struct Frame {
+        int comp;
+        int member;
+        int edge;
+    };
+    std::vector<Frame> stack;
+    auto findSink = [&](int source) {
+        flags[source] |= kVisited;
+        if (!(flags[source] & kHasOut)) {
+            return source;
+        }
+        stack.assign(1, Frame{source, first[source], 0});
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            if (frame.member == first[frame.comp + 1]) {
+                stack.pop_back();
+                continue;
+            }
+            auto neighbors = graph.getNeighbors(members[frame.member]);
+            if (frame.edge == static_cast<int>(neighbors.size())) {
+                frame.member++;
+                frame.edge = 0;
+                continue;
+            }
+            int next = comp_id[neighbors[frame.edge++]];
+            if (flags[next] & kVisited) {
+                continue;
+            }
+            flags[next] |= kVisited;
+            if (!(flags[next] & kHasOut)) {
+                return next;
+            }
+            stack.push_back(Frame{next, first[next], 0});
+        }
+        return -1;
+    };
+
+    // Сначала пары в одинаковом порядке, затем свободные истоки и стоки.
+    // kMatched у истока и у стока: компонента бывает и тем и другим, только
+    // если изолирована, а тогда она в паре сама с собой
+    std::vector<int> sources;
+    std::vector<int> sinks;
+    for (int c = 0; c < k; ++c) {
+        if (!(flags[c] & kHasIn)) {
+            int sink = findSink(c);
+            if (sink != -1) {
+                sources.push_back(c);
+                sinks.push_back(sink);
+                flags[c] |= kMatched;
+                flags[sink] |= kMatched;
+            }
+        }
+    }
+    int pairs = static_cast<int>(sources.size());
+    for (int c = 0; c < k; ++c) {
+        if (flags[c] & kMatched) {
+            continue;
+        }
+        if (!(flags[c] & kHasIn)) {
+            sources.push_back(c);
+        }
+        if (!(flags[c] & kHasOut)) {
+            sinks.push_back(c);
+        }
+    }
+
+    std::vector<std::pair<int, int>> result;
+    bool reverse = sources.size() > sinks.size();
+    const std::vector<int>& from = reverse ? sinks : sources;
+    const std::vector<int>& to = reverse ? sources : sinks;
+    auto emit = [&](int a, int b) {
+        int u = members[first[a]] + 1;
+        int v = members[first[b]] + 1;
+        result.push_back(reverse ? std::make_pair(v, u) : std::make_pair(u, v));
+    };
+
+    int s = static_cast<int>(from.size());
+    int t = static_cast<int>(to.size());
+    result.reserve(t);
+    for (int i = 0; i + 1 < pairs; ++i) {
+        emit(to[i], from[i + 1]);
+    }
+    for (int i = pairs; i < s; ++i) {
+        emit(to[i], from[i]);
+    }
+    if (s == t) {
+        emit(to[pairs - 1], from[0]);
+    } else {
+        emit(to[pairs - 1], to[s]);
+        for (int i = s; i + 1 < t; ++i) {
+            emit(to[i], to[i + 1]);
+        }
+        emit(to[t - 1], from[0]);
+    }
+    return result;
+}
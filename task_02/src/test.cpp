@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "city_connector.hpp"
+#include "graph_generator.hpp"
 
 // Вспомогательная функция для создания графа из списка рёбер
 CityConnector createConnectorFromEdges(int n, const std::vector<std::pair<int, int>>& edges) {
@@ -139,6 +140,199 @@ TEST(CityConnectorTest, GraphWithSelfLoops) {
     EXPECT_EQ(connector.findMinRoadsToConnect(), 1);
 }
 
+// Тест 16: Пирс и Косарайю находят одни и те же компоненты
+TEST(CityConnectorTest, PearceMatchesKosaraju) {
+    for (int seed = 1; seed <= 20; ++seed) {
+        const int n = 200;
+        GraphGenerator generator(seed);
+        CityConnector connector(n);
+        generator.erdosRenyi(n, n + 15 * seed, true, [&](int u, int v) {
+            connector.addRoad(u + 1, v + 1);
+        });
+        
+        int expected = connector.findMinRoadsToConnect(SccAlgorithm::Kosaraju);
+        int expected_components = connector.getComponentsCount();
+        EXPECT_EQ(connector.findMinRoadsToConnect(SccAlgorithm::Pearce), expected) << seed;
+        EXPECT_EQ(connector.getComponentsCount(), expected_components) << seed;
+    }
+}
+
+// Тест 17: Глубокий цикл не переполняет стек
+TEST(CityConnectorTest, PearceDeepCycle) {
+    const int n = 1000000;
+    CityConnector connector(n);
+    for (int v = 1; v < n; ++v) {
+        connector.addRoad(v, v + 1);
+    }
+    EXPECT_EQ(connector.findMinRoadsToConnect(), 1);
+    EXPECT_EQ(connector.getComponentsCount(), n);
+    
+    connector.addRoad(n, 1);
+    EXPECT_EQ(connector.findMinRoadsToConnect(), 0);
+    EXPECT_EQ(connector.getComponentsCount(), 1);
+}
+
+// Номера компонент в порядке первого появления: одинаковые разбиения
+// дают одинаковый результат при любой нумерации
+static std::vector<int> canonicalPartition(const std::vector<int>& ids) {
+    std::vector<int> renumber(ids.size(), -1);
+    std::vector<int> result;
+    int next = 0;
+    for (int id : ids) {
+        if (renumber[id] == -1) {
+            renumber[id] = next++;
+        }
+        result.push_back(renumber[id]);
+    }
+    return result;
+}
+
+// Тест 18: Параллельный поиск даёт тот же ответ, что и Пирс, включая
+// графы больше порога, после которого включается раскраска
+TEST(CityConnectorTest, ParallelMatchesPearce) {
+    struct Case {
+        int n;
+        long long m;
+    };
+    for (Case test : {Case{300, 400}, Case{50000, 55000}, Case{50000, 150000}, Case{80000, 60000}}) {
+        GraphGenerator generator(test.n + test.m);
+        CityConnector connector(test.n);
+        generator.erdosRenyi(test.n, test.m, true, [&](int u, int v) {
+            connector.addRoad(u + 1, v + 1);
+        });
+        // Пары u <-> v для отсечения вторым правилом
+        for (int v = 1; v + 1 <= test.n && v < 200; v += 2) {
+            connector.addRoad(v, v + 1);
+            connector.addRoad(v + 1, v);
+        }
+        
+        int expected = connector.findMinRoadsToConnect(SccAlgorithm::Pearce);
+        int expected_components = connector.getComponentsCount();
+        auto expected_partition = canonicalPartition(connector.getComponentIds());
+        for (int threads : {1, 2, 4}) {
+            EXPECT_EQ(connector.findMinRoadsToConnect(SccAlgorithm::Parallel, threads), expected)
+                << test.n << " " << threads;
+            EXPECT_EQ(connector.getComponentsCount(), expected_components) << test.n << " " << threads;
+            EXPECT_EQ(canonicalPartition(connector.getComponentIds()), expected_partition)
+                << test.n << " " << threads;
+        }
+    }
+}
+
+// Тест 19: Длинная цепочка циклов из трёх вершин не разбирается отсечением
+TEST(CityConnectorTest, ParallelChainOfCycles) {
+    const int cycles = 20000;
+    CityConnector connector(3 * cycles);
+    for (int i = 0; i < cycles; ++i) {
+        int a = 3 * i + 1;
+        connector.addRoad(a, a + 1);
+        connector.addRoad(a + 1, a + 2);
+        connector.addRoad(a + 2, a);
+        if (i + 1 < cycles) {
+            connector.addRoad(a + 2, a + 3);
+        }
+    }
+    EXPECT_EQ(connector.findMinRoadsToConnect(SccAlgorithm::Parallel, 3), 1);
+    EXPECT_EQ(connector.getComponentsCount(), cycles);
+}
+
+// Тест 20: Инкрементальный режим после каждой дороги совпадает с полным
+// пересчётом, в том числе когда режим включён на уже заполненном графе
+TEST(CityConnectorTest, IncrementalMatchesRecompute) {
+    for (int n : {2, 7, 40, 300}) {
+        for (int initial : {0, n / 2}) {
+            GraphGenerator generator(n * 31 + initial);
+            auto roads = GraphGenerator::collect([&](auto&& sink) {
+                generator.erdosRenyi(n, 3 * n, true, sink);
+            });
+            CityConnector connector(n);
+            CityConnector reference(n);
+            for (int i = 0; i < initial; ++i) {
+                connector.addRoad(roads[i].first + 1, roads[i].second + 1);
+                reference.addRoad(roads[i].first + 1, roads[i].second + 1);
+            }
+            connector.enableIncrementalMode();
+            ASSERT_TRUE(connector.isIncremental());
+            
+            for (std::size_t i = initial; i < roads.size(); ++i) {
+                connector.addRoad(roads[i].first + 1, roads[i].second + 1);
+                reference.addRoad(roads[i].first + 1, roads[i].second + 1);
+                ASSERT_EQ(connector.findMinRoadsToConnect(), reference.findMinRoadsToConnect())
+                    << n << " " << i;
+                ASSERT_EQ(connector.getIncremental().getComponentsCount(),
+                          reference.getComponentsCount()) << n << " " << i;
+            }
+        }
+    }
+}
+
+// Тест 21: Путь, добавляемый с конца, каждый раз нарушает порядок, а
+// замыкающая дорога сливает все вершины в одну компоненту
+TEST(CityConnectorTest, IncrementalReversedPathMerges) {
+    const int n = 2000;
+    CityConnector connector(n);
+    connector.enableIncrementalMode();
+    for (int v = n - 1; v >= 1; --v) {
+        connector.addRoad(v, v + 1);
+    }
+    EXPECT_EQ(connector.findMinRoadsToConnect(), 1);
+    EXPECT_EQ(connector.getIncremental().getComponentsCount(), n);
+    
+    connector.addRoad(n, 1);
+    EXPECT_EQ(connector.findMinRoadsToConnect(), 0);
+    EXPECT_EQ(connector.getIncremental().getComponentsCount(), 1);
+    EXPECT_EQ(connector.getIncremental().getSourcesCount(), 1);
+}
+
+// Добавляет найденные дороги и проверяет, что их минимум и город связен
+static void expectRoadsConnect(CityConnector& connector, int n) {
+    int expected = connector.findMinRoadsToConnect();
+    auto roads = connector.findRoadsToConnect();
+    ASSERT_EQ(static_cast<int>(roads.size()), expected);
+    for (const auto& [from, to] : roads) {
+        ASSERT_GE(from, 1);
+        ASSERT_LE(to, n);
+        connector.addRoad(from, to);
+    }
+    EXPECT_EQ(connector.findMinRoadsToConnect(), 0);
+    EXPECT_EQ(connector.getComponentsCount(), 1);
+}
+
+// Тест 22: Найденные дороги делают город одним кварталом на случайных
+// графах, где истоков то больше, то меньше стоков
+TEST(CityConnectorTest, RoadsToConnectRandom) {
+    for (int n : {2, 5, 30, 1000, 20000}) {
+        for (int degree : {0, 1, 2}) {
+            GraphGenerator generator(n * 7 + degree);
+            CityConnector connector(n);
+            generator.erdosRenyi(n, static_cast<long long>(n) * degree / 2 + n / 3, true,
+                                 [&](int u, int v) { connector.addRoad(u + 1, v + 1); });
+            expectRoadsConnect(connector, n);
+        }
+    }
+}
+
+// Тест 23: Звёзды наружу и внутрь, изолированные вершины и уже связный город
+TEST(CityConnectorTest, RoadsToConnectShapes) {
+    const int n = 50;
+    CityConnector out_star(n);
+    CityConnector in_star(n);
+    for (int v = 2; v <= n; ++v) {
+        out_star.addRoad(1, v);
+        in_star.addRoad(v, 1);
+    }
+    expectRoadsConnect(out_star, n);
+    expectRoadsConnect(in_star, n);
+    
+    CityConnector isolated(n);
+    isolated.addRoad(1, 2);
+    isolated.addRoad(2, 1);
+    expectRoadsConnect(isolated, n);
+    
+    CityConnector cycle = createConnectorFromEdges(3, {{1, 2}, {2, 3}, {3, 1}});
+    EXPECT_TRUE(cycle.findRoadsToConnect().empty());
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
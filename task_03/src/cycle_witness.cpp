@@ -0,0 +1,145 @@
+#include "topological_sorter.hpp"
+#include "perf_stats.hpp"
+#include <algorithm>
+
+// Диагностика циклов без второго обхода графа.
+//
+// sortDiagnostic - DFS Пирса (как CityConnector::labelComponentsPearce в
+// task_02): одно число rindex на вершину, бит root_candidate и стек вершин
+// открытых компонент. Обход не останавливается на первом цикле: на выходе
+// либо обратный порядок выхода - топологический порядок, либо все
+// нетривиальные компоненты. Первая дуга в серую вершину (она на пути DFS)
+// даёт свидетельство - часть стека dfs_engine, как и в обычном DFS.
+//
+// findResidualCycle - для Кана: вершины, не попавшие в порядок, - это
+// циклы и всё, что из них достижимо. DFS только по ним находит цикл, не
+// трогая уже упорядоченную часть графа.
+
+bool TopologicalSorter::sortDiagnostic() {
+    PERF_PHASE("toposort.diagnostic");
+    // rindex = 0 - вершина не посещена
+    std::vector<int>& rindex = visited;
+    rindex.assign(vertices_count, 0);
+    std::vector<bool> root_candidate(vertices_count, false);
+    std::vector<bool> on_path(vertices_count, false);
+    std::vector<int> open;
+    result.clear();
+
+    struct Visitor : DfsVisitor {
+        TopologicalSorter& sorter;
+        std::vector<int>& rindex;
+        std::vector<bool>& root_candidate;
+        std::vector<bool>& on_path;
+        std::vector<int>& open;
+        int index = 1;
+        int next_component;
+
+        void lower(int v, int w) {
+            if (rindex[w] < rindex[v]) {
+                rindex[v] = rindex[w];
+                root_candidate[v] = false;
+            }
+        }
+
+        void enter(int v, int) {
+            rindex[v] = index++;
+            root_candidate[v] = true;
+            on_path[v] = true;
+        }
+
+        DfsAction edge(int v, int, int to, long long) {
+            if (rindex[to] == 0) {
+                return DfsAction::Descend;
+            }
+            if (on_path[to] && sorter.cycle.empty()) {
+                sorter.cycleFromStack(to);
+            }
+            lower(v, to);
+            return DfsAction::Skip;
+        }
+
+        void retreat(int v, int child, long long) {
+            lower(v, child);
+        }
+
+        void leave(int v, int) {
+            on_path[v] = false;
+            sorter.result.push_back(v);
+            if (!root_candidate[v]) {
+                open.push_back(v);
+                return;
+            }
+            // v - корень: снимаем со стека всю его компоненту
+            index--;
+            std::vector<int> members;
+            while (!open.empty() && rindex[v] <= rindex[open.back()]) {
+                members.push_back(open.back());
+                rindex[open.back()] = next_component;
+                open.pop_back();
+                index--;
+            }
+            rindex[v] = next_component--;
+
+            auto neighbors = sorter.graph.getNeighbors(v);
+            if (!members.empty() || std::find(neighbors.begin(), neighbors.end(), v) != neighbors.end()) {
+                members.push_back(v);
+                sorter.cyclic_components.push_back(std::move(members));
+            }
+        }
+    };
+
+    Visitor visitor{{}, *this, rindex, root_candidate, on_path, open, 1, vertices_count - 1};
+    for (int v = 0; v < vertices_count; ++v) {
+        if (rindex[v] == 0) {
+            dfs_engine.run(graph, v, visitor);
+        }
+    }
+
+    if (!cyclic_components.empty()) {
+        PERF_COUNT_ADD("toposort.diagnostic.components", cyclic_components.size());
+        return false;
+    }
+    std::reverse(result.begin(), result.end());
+    return true;
+}
+
+void TopologicalSorter::findResidualCycle() {
+    PERF_PHASE("toposort.residual_cycle");
+    // 0 - не в порядке и не посещена, 1 - на пути DFS, 2 - готова
+    std::vector<char> color(vertices_count, 0);
+    for (int v : result) {
+        color[v] = 2;
+    }
+
+    struct Visitor : DfsVisitor {
+        std::vector<char>& color;
+        int cycle_start = -1;
+
+        void enter(int v, int) {
+            color[v] = 1;
+        }
+
+        DfsAction edge(int, int, int to, long long) {
+            if (color[to] == 0) {
+                return DfsAction::Descend;
+            }
+            if (color[to] == 2) {
+                return DfsAction::Skip;
+            }
+            cycle_start = to;
+            return DfsAction::Stop;
+        }
+
+        void leave(int v, int) {
+            color[v] = 2;
+        }
+    };
+
+    Visitor visitor{{}, color};
+    for (int v = 0; v < vertices_count; ++v) {
+        if (color[v] == 0 && dfs_engine.run(graph, v, visitor)) {
+            cycleFromStack(visitor.cycle_start);
+            return;
+        }
+    }
+}
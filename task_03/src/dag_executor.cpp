@@ -0,0 +1,224 @@
+#include "dag_executor.hpp"
+#include "topological_sorter.hpp"
+#include "perf_stats.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+// Очередь готовых задач одного потока
+struct alignas(64) WorkerQueue {
+    std::mutex mutex;
+    std::vector<int> heap;
+};
+
+// Сколько раз поток без работы уступает процессор, прежде чем уснуть
+constexpr int kSpinRounds = 16;
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+DagExecutor::DagExecutor(TopologicalSorter& sorter, std::vector<double> cost_hints)
+    : vertices_count(sorter.getGraph().getVerticesCount()),
+      graph(sorter.getGraph()),
+      acyclic(sorter.sort()) {
+    if (!cost_hints.empty() && static_cast<int>(cost_hints.size()) != vertices_count) {
+        throw std::invalid_argument("DagExecutor: cost_hints size differs from the vertex count");
+    }
+    if (!acyclic) {
+        return;
+    }
+    order = sorter.getOrder();
+    if (cost_hints.empty()) {
+        cost_hints.assign(vertices_count, 1.0);
+    }
+
+    // Приоритет - самый длинный путь до стока по подсказкам, включая саму задачу
+    priority.assign(vertices_count, 0);
+    for (int i = vertices_count - 1; i >= 0; --i) {
+        int v = order[i];
+        double longest = 0;
+        for (int w : graph.getNeighbors(v)) {
+            longest = std::max(longest, priority[w]);
+        }
+        priority[v] = cost_hints[v] + longest;
+    }
+}
+
+bool DagExecutor::run(const std::function<void(int)>& task, int threads) {
+    stats = ExecutionStats();
+    if (!acyclic) {
+        return false;
+    }
+    PERF_PHASE("toposort.execute");
+    ThreadPool pool(threads);
+    int workers_count = pool.getThreadsCount();
+
+    std::vector<int> in_degree(vertices_count, 0);
+    for (int v = 0; v < vertices_count; ++v) {
+        for (int w : graph.getNeighbors(v)) {
+            in_degree[w]++;
+        }
+    }
+
+    auto lower = [&](int a, int b) { return priority[a] < priority[b]; };
+    std::vector<WorkerQueue> queues(workers_count);
+    int next = 0;
+    for (int v = 0; v < vertices_count; ++v) {
+        if (in_degree[v] == 0) {
+            queues[next++ % workers_count].heap.push_back(v);
+        }
+    }
+    for (WorkerQueue& queue : queues) {
+        std::make_heap(queue.heap.begin(), queue.heap.end(), lower);
+    }
+
+    // ready - задачи в очередях, ещё никем не взятые. Поток без работы
+    // обходит чужие очереди, только увидев ready > 0, а иначе засыпает на
+    // idle. sleepers и ready меняются seq_cst: либо спящий увидит новую
+    // задачу до сна, либо положивший её увидит спящего и разбудит
+    std::atomic<int> ready(next);
+    std::atomic<int> sleepers(0);
+    std::mutex idle_mutex;
+    std::condition_variable idle;
+
+    auto pop = [&](WorkerQueue& queue) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.heap.empty()) {
+            return -1;
+        }
+        std::pop_heap(queue.heap.begin(), queue.heap.end(), lower);
+        int v = queue.heap.back();
+        queue.heap.pop_back();
+        ready.fetch_sub(1);
+        return v;
+    };
+
+    // Своя очередь, затем чужие по кругу
+    auto take = [&](int thread) {
+        for (int k = 0; k < workers_count; ++k) {
+            int v = pop(queues[(thread + k) % workers_count]);
+            if (v != -1) {
+                if (k > 0) {
+                    PERF_COUNT("toposort.execute.steals");
+                }
+                return v;
+            }
+        }
+        return -1;
+    };
+
+    std::vector<double> duration(vertices_count, 0);
+    std::atomic<int> remaining(vertices_count);
+
+    // false - все задачи выполнены. Сначала короткое ожидание без
+    // блокировок: соседняя задача часто вот-вот освободит следующую
+    auto waitForWork = [&]() {
+        for (int spin = 0; spin < kSpinRounds; ++spin) {
+            if (remaining.load() == 0) {
+                return false;
+            }
+            if (ready.load() > 0) {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        PERF_COUNT("toposort.execute.sleeps");
+        std::unique_lock<std::mutex> lock(idle_mutex);
+        sleepers.fetch_add(1);
+        idle.wait(lock, [&] { return ready.load() > 0 || remaining.load() == 0; });
+        sleepers.fetch_sub(1);
+        return remaining.load() > 0;
+    };
+
+    auto wake = [&](bool all) {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+        if (all) {
+            idle.notify_all();
+        } else {
+            idle.notify_one();
+        }
+    };
+
+    Clock::time_point start = Clock::now();
+
+    pool.runOnAll([&](int thread) {
+        WorkerQueue& own = queues[thread];
+        while (true) {
+            int v = take(thread);
+            if (v == -1) {
+                if (!waitForWork()) {
+                    break;
+                }
+                continue;
+            }
+
+            Clock::time_point task_start = Clock::now();
+            task(v);
+            duration[v] = secondsSince(task_start);
+
+            // acq_rel: последний освободивший видит результаты всех предков,
+            // а мьютекс очереди передаёт их потоку, который возьмёт задачу.
+            // Одну задачу из своей очереди этот поток возьмёт сам, за
+            // остальными будится спящий
+            for (int w : graph.getNeighbors(v)) {
+                if (std::atomic_ref<int>(in_degree[w]).fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    bool surplus;
+                    {
+                        std::lock_guard<std::mutex> lock(own.mutex);
+                        own.heap.push_back(w);
+                        std::push_heap(own.heap.begin(), own.heap.end(), lower);
+                        surplus = own.heap.size() > 1;
+                    }
+                    ready.fetch_add(1);
+                    if (surplus && sleepers.load() > 0) {
+                        wake(false);
+                    }
+                }
+            }
+            if (remaining.fetch_sub(1) == 1) {
+                wake(true);
+            }
+        }
+    });
+    stats.wall_time = secondsSince(start);
+
+    // Критический путь по фактическим длительностям
+    std::vector<double> longest(vertices_count, 0);
+    std::vector<int> tasks(vertices_count, 0);
+    for (int i = vertices_count - 1; i >= 0; --i) {
+        int v = order[i];
+        int next_task = -1;
+        for (int w : graph.getNeighbors(v)) {
+            if (next_task == -1 || longest[w] > longest[next_task]) {
+                next_task = w;
+            }
+        }
+        longest[v] = duration[v] + (next_task == -1 ? 0 : longest[next_task]);
+        tasks[v] = 1 + (next_task == -1 ? 0 : tasks[next_task]);
+        stats.total_work += duration[v];
+        if (longest[v] > stats.critical_path ||
+            (longest[v] == stats.critical_path && tasks[v] > stats.critical_path_tasks)) {
+            stats.critical_path = longest[v];
+            stats.critical_path_tasks = tasks[v];
+        }
+    }
+    if (stats.wall_time > 0) {
+        stats.achieved_parallelism = stats.total_work / stats.wall_time;
+    }
+    if (stats.critical_path > 0) {
+        stats.available_parallelism = stats.total_work / stats.critical_path;
+    }
+    return true;
+}
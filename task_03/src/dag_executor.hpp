@@ -0,0 +1,60 @@
+#ifndef DAG_EXECUTOR_HPP
+#define DAG_EXECUTOR_HPP
+
+#include <functional>
+#include <vector>
+#include "csr_graph.hpp"
+
+class TopologicalSorter;
+
+// Итоги последнего run(); времена в секундах. Длительность задачи - время
+// по часам от начала до конца, поэтому при потоках больше, чем ядер, работа
+// завышается вместе с вытеснениями
+struct ExecutionStats {
+    double wall_time = 0;
+    double total_work = 0;              // сумма длительностей задач
+    double critical_path = 0;           // самая длинная цепочка по длительностям
+    int critical_path_tasks = 0;        // задач в этой цепочке
+    double achieved_parallelism = 0;    // total_work / wall_time
+    double available_parallelism = 0;   // total_work / critical_path
+};
+
+// Выполнение задач-вершин DAG в порядке зависимостей на нескольких потоках.
+// Дуга u -> v: задача v начинается после завершения u. Счётчик входящих
+// степеней вершины атомарно уменьшается её предками; поток, доведший его
+// до нуля, кладёт вершину в свою очередь.
+//
+// Очередь потока - куча по приоритету под своим мьютексом: приоритет -
+// самый длинный путь от вершины до стока по подсказкам стоимости, так что
+// первыми идут задачи критического пути. Поток без работы забирает самую
+// приоритетную задачу у другого, а если готовых задач нигде нет - засыпает
+// до появления новой и не занимает ядро. Очередь с приоритетом нельзя сделать
+// деком Чейза - Лева без блокировок, поэтому задачи должны быть заметно
+// дороже захвата мьютекса.
+class DagExecutor {
+private:
+    int vertices_count;
+    const CsrGraph& graph;
+    bool acyclic;
+    std::vector<int> order;
+    std::vector<double> priority;
+    ExecutionStats stats;
+
+public:
+    // Граф и топологический порядок берутся у sorter (он вызывает sort());
+    // граф не копируется, так что sorter должен жить дольше исполнителя
+    // и не получать новых дуг. cost_hints - ожидаемая стоимость задач,
+    // по одной на вершину (иначе invalid_argument), по умолчанию все по 1
+    explicit DagExecutor(TopologicalSorter& sorter, std::vector<double> cost_hints = {});
+
+    bool isAcyclic() const { return acyclic; }
+
+    // Вызывает task(v) для каждой вершины (с 0) на threads потоках
+    // (threads <= 0 - по числу ядер). false, если в графе цикл: тогда ничего
+    // не выполняется. Задачи не должны бросать исключений
+    bool run(const std::function<void(int)>& task, int threads = 0);
+
+    const ExecutionStats& getStats() const { return stats; }
+};
+
+#endif
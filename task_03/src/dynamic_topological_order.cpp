@@ -0,0 +1,121 @@
+#include "dynamic_topological_order.hpp"
+#include "perf_stats.hpp"
+#include <algorithm>
+#include <numeric>
+
+DynamicTopologicalOrder::DynamicTopologicalOrder(int n)
+    : vertices_count(n),
+      position(n),
+      order(n),
+      out_arcs(n),
+      in_arcs(n),
+      stamp(0),
+      mark(n, 0) {
+    std::iota(position.begin(), position.end(), 0);
+    std::iota(order.begin(), order.end(), 0);
+}
+
+DynamicTopologicalOrder::DynamicTopologicalOrder(
+    const CsrGraph& graph,
+    const std::vector<int>& initial_order
+)
+    : DynamicTopologicalOrder(graph.getVerticesCount()) {
+    PERF_PHASE("toposort.dynamic.build");
+    order = initial_order;
+    for (int i = 0; i < vertices_count; ++i) {
+        position[order[i]] = i;
+    }
+    for (int u = 0; u < vertices_count; ++u) {
+        for (int v : graph.getNeighbors(u)) {
+            out_arcs[u].push_back(v);
+            in_arcs[v].push_back(u);
+        }
+    }
+}
+
+bool DynamicTopologicalOrder::searchForward(int start, int upper, int target) {
+    forward_set.clear();
+    stack.assign(1, start);
+    mark[start] = stamp;
+    while (!stack.empty()) {
+        int v = stack.back();
+        stack.pop_back();
+        forward_set.push_back(v);
+        for (int w : out_arcs[v]) {
+            if (w == target) {
+                return false;
+            }
+            if (mark[w] != stamp && position[w] < upper) {
+                mark[w] = stamp;
+                stack.push_back(w);
+            }
+        }
+    }
+    return true;
+}
+
+void DynamicTopologicalOrder::searchBackward(int start, int lower) {
+    backward_set.clear();
+    stack.assign(1, start);
+    mark[start] = stamp;
+    while (!stack.empty()) {
+        int v = stack.back();
+        stack.pop_back();
+        backward_set.push_back(v);
+        for (int w : in_arcs[v]) {
+            // Вершины F сюда не попадут: иначе F дошло бы до start
+            if (mark[w] != stamp && position[w] > lower) {
+                mark[w] = stamp;
+                stack.push_back(w);
+            }
+        }
+    }
+}
+
+bool DynamicTopologicalOrder::addEdge(int u, int v) {
+    if (u == v) {
+        return false;
+    }
+    int lower = position[v];
+    int upper = position[u];
+    if (lower > upper) {
+        out_arcs[u].push_back(v);
+        in_arcs[v].push_back(u);
+        return true;
+    }
+
+    PERF_COUNT("toposort.dynamic.reorders");
+    stamp++;
+    if (!searchForward(v, upper, u)) {
+        PERF_COUNT("toposort.dynamic.rejected");
+        return false;
+    }
+    searchBackward(u, lower);
+    out_arcs[u].push_back(v);
+    in_arcs[v].push_back(u);
+    PERF_COUNT_ADD("toposort.dynamic.moved", forward_set.size() + backward_set.size());
+
+    auto by_position = [&](int a, int b) { return position[a] < position[b]; };
+    std::sort(forward_set.begin(), forward_set.end(), by_position);
+    std::sort(backward_set.begin(), backward_set.end(), by_position);
+
+    // Позиции обоих множеств по возрастанию раздаются сначала B, затем F
+    slots.clear();
+    for (int w : backward_set) {
+        slots.push_back(position[w]);
+    }
+    for (int w : forward_set) {
+        slots.push_back(position[w]);
+    }
+    std::sort(slots.begin(), slots.end());
+    std::size_t slot = 0;
+    for (int w : backward_set) {
+        position[w] = slots[slot];
+        order[slots[slot++]] = w;
+    }
+    for (int w : forward_set) {
+        position[w] = slots[slot];
+        order[slots[slot++]] = w;
+    }
+    return true;
+}
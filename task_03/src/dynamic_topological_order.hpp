@@ -0,0 +1,50 @@
+#ifndef DYNAMIC_TOPOLOGICAL_ORDER_HPP
+#define DYNAMIC_TOPOLOGICAL_ORDER_HPP
+
+#include <vector>
+#include "csr_graph.hpp"
+
+// Топологический порядок, поддерживаемый при добавлении дуг (Пирс - Келли).
+// Вершины с 0, как внутри TopologicalSorter.
+//
+// Дуга u -> v с position[u] < position[v] порядок не нарушает. Иначе
+// затронут только отрезок [position[v], position[u]]: F - достижимые из v
+// в его пределах, B - достигающие u. Если F дошло до u, дуга замкнула бы
+// цикл и отклоняется. Иначе B и F получают те же позиции, сначала B, затем
+// F, каждое в прежнем взаимном порядке. Работа пропорциональна F и B с их
+// дугами, а не n + m.
+class DynamicTopologicalOrder {
+private:
+    int vertices_count;
+
+    std::vector<int> position;
+    std::vector<int> order;
+    std::vector<std::vector<int>> out_arcs;
+    std::vector<std::vector<int>> in_arcs;
+
+    // Метки обходов: совпадение со stamp - «в текущем проходе»
+    unsigned stamp;
+    std::vector<unsigned> mark;
+    std::vector<int> forward_set;
+    std::vector<int> backward_set;
+    std::vector<int> stack;
+    std::vector<int> slots;
+
+    // false, если обход из start дошёл до target
+    bool searchForward(int start, int upper, int target);
+    void searchBackward(int start, int lower);
+
+public:
+    // n вершин без дуг, порядок 0, 1, ..., n - 1
+    explicit DynamicTopologicalOrder(int n);
+    // Ацикличный граф и его корректный топологический порядок
+    DynamicTopologicalOrder(const CsrGraph& graph, const std::vector<int>& initial_order);
+
+    // false - дуга замкнула бы цикл, граф не изменился
+    bool addEdge(int u, int v);
+
+    const std::vector<int>& getOrder() const { return order; }
+    int getPosition(int v) const { return position[v]; }
+};
+
+#endif
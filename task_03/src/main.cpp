@@ -1,6 +1,14 @@
 #include "topological_sorter.hpp"
+#include <cstdio>
+#include <exception>
 
 int main() {
-    TopologicalSorter::solveTopologicalSort();
+    // Повреждённый или чужой бинарный граф (GraphFile) - сообщение, а не abort
+    try {
+        TopologicalSorter::solveTopologicalSort();
+    } catch (const std::exception& error) {
+        std::fprintf(stderr, "task_03: %s\n", error.what());
+        return 1;
+    }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,86 @@
+#include "topological_sorter.hpp"
+#include "perf_stats.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+
+// Алгоритм Кана по уровням. Фронт - вершины, у которых не осталось
+// необработанных входящих дуг; весь фронт разбирается параллельно, каждая
+// дуга атомарно уменьшает входящую степень своего конца, и тот поток,
+// который довёл её до нуля, кладёт вершину в свой буфер следующего уровня.
+// Буферы потоков дописываются в result после уровня, поэтому result сразу
+// и ответ, и очередь: фронт уровня - его отрезок [begin, end).
+//
+// Уровень вершины - длина самого длинного пути к ней из истока: вершина
+// попадает во фронт, когда обработан последний, самый глубокий предок.
+// Если в result попали не все вершины, остаток лежит на циклах или
+// достижим из них - цикл обнаруживается точно.
+
+namespace {
+
+constexpr std::size_t kGrain = 1024;
+
+}  // namespace
+
+bool TopologicalSorter::sortParallelKahn(int threads) {
+    PERF_PHASE("toposort.kahn");
+    ThreadPool pool(threads);
+    std::vector<std::vector<int>> local(pool.getThreadsCount());
+
+    // Входящие степени - в visited, он нужен только DFS. На одном потоке
+    // атомарные операции не нужны, а на каждой дуге они заметно дороже
+    std::vector<int>& in_degree = visited;
+    in_degree.assign(vertices_count, 0);
+    bool shared = pool.getThreadsCount() > 1;
+    auto add = [&](int w, int delta) {
+        if (shared) {
+            return std::atomic_ref<int>(in_degree[w]).fetch_add(delta, std::memory_order_relaxed) + delta;
+        }
+        return in_degree[w] += delta;
+    };
+    pool.parallelFor(0, vertices_count, kGrain, [&](std::size_t from, std::size_t to, int) {
+        for (std::size_t v = from; v < to; ++v) {
+            for (int w : graph.getNeighbors(static_cast<int>(v))) {
+                add(w, 1);
+            }
+        }
+    });
+
+    result.clear();
+    result.reserve(vertices_count);
+    levels.assign(vertices_count, 0);
+    auto flush = [&]() {
+        for (std::vector<int>& part : local) {
+            result.insert(result.end(), part.begin(), part.end());
+            part.clear();
+        }
+    };
+
+    pool.parallelFor(0, vertices_count, kGrain, [&](std::size_t from, std::size_t to, int thread) {
+        for (std::size_t v = from; v < to; ++v) {
+            if (in_degree[v] == 0) {
+                local[thread].push_back(static_cast<int>(v));
+            }
+        }
+    });
+    flush();
+
+    std::size_t begin = 0;
+    for (int level = 1; begin < result.size(); ++level) {
+        PERF_COUNT("toposort.kahn.levels");
+        std::size_t end = result.size();
+        pool.parallelFor(begin, end, kGrain, [&](std::size_t from, std::size_t to, int thread) {
+            for (std::size_t i = from; i < to; ++i) {
+                for (int w : graph.getNeighbors(result[i])) {
+                    if (add(w, -1) == 0) {
+                        levels[w] = level;
+                        local[thread].push_back(w);
+                    }
+                }
+            }
+        });
+        flush();
+        begin = end;
+    }
+
+    return static_cast<int>(result.size()) == vertices_count;
+}
@@ -1,7 +1,16 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <stdexcept>
+#include <queue>
 #include <unordered_set>
+#include "graph_generator.hpp"
+#include "dag_executor.hpp"
+#include "topological_sorter.hpp"
 
 // Простая реализация для тестов
 class SimpleTopologicalSorter {
@@ -214,6 +223,350 @@ TEST(TopologicalSortTest, ReverseChain) {
     EXPECT_EQ(order[2], 0);
 }
 
+// Самые длинные пути из истоков по готовому порядку
+std::vector<int> longestPathLevels(int n, const std::vector<std::pair<int, int>>& edges,
+                                   const std::vector<int>& order) {
+    std::vector<std::vector<int>> out(n);
+    for (auto [u, v] : edges) {
+        out[u].push_back(v);
+    }
+    std::vector<int> level(n, 0);
+    for (int v : order) {
+        for (int w : out[v]) {
+            level[w] = std::max(level[w], level[v] + 1);
+        }
+    }
+    return level;
+}
+
+// ТЕСТ 11: Кан по уровням даёт корректный порядок и уровни на любом числе потоков
+TEST(TopologicalSortTest, ParallelKahnRandomDag) {
+    for (int n : {1, 50, 3000, 40000}) {
+        GraphGenerator generator(n);
+        auto edges = GraphGenerator::collect([&](auto&& sink) {
+            generator.randomDag(n, 4LL * n, sink);
+        });
+        TopologicalSorter sorter(n);
+        for (auto [u, v] : edges) {
+            sorter.addEdge(u + 1, v + 1);
+        }
+        for (int threads : {1, 2, 4}) {
+            ASSERT_TRUE(sorter.sort(SortAlgorithm::ParallelKahn, threads));
+            EXPECT_TRUE(checkOrder(n, edges, sorter.getOrder())) << n << " " << threads;
+            EXPECT_EQ(sorter.getLevels(), longestPathLevels(n, edges, sorter.getOrder()))
+                << n << " " << threads;
+        }
+        ASSERT_TRUE(sorter.sort());
+        EXPECT_TRUE(sorter.getLevels().empty());
+    }
+}
+
+// ТЕСТ 12: Цикл глубоко внутри DAG и цикл, недостижимый из истоков
+TEST(TopologicalSortTest, ParallelKahnDetectsCycles) {
+    const int n = 20000;
+    GraphGenerator generator(12);
+    auto edges = GraphGenerator::collect([&](auto&& sink) {
+        generator.randomDag(n, 3LL * n, sink);
+    });
+    TopologicalSorter sorter(n);
+    for (auto [u, v] : edges) {
+        sorter.addEdge(u + 1, v + 1);
+    }
+    ASSERT_TRUE(sorter.sort());
+    // Обратная к дуге DAG дуга замыкает цикл из двух вершин
+    auto [u, v] = edges[edges.size() / 2];
+    sorter.addEdge(v + 1, u + 1);
+    for (int threads : {1, 4}) {
+        EXPECT_FALSE(sorter.sort(SortAlgorithm::ParallelKahn, threads));
+    }
+    EXPECT_FALSE(sorter.sort());
+
+    TopologicalSorter closed(4);
+    closed.addEdge(1, 2);
+    closed.addEdge(3, 4);
+    closed.addEdge(4, 3);
+    EXPECT_FALSE(closed.sort(SortAlgorithm::ParallelKahn, 2));
+}
+
+// ТЕСТ 13: Инкрементальный режим держит порядок корректным и отклоняет
+// ровно те дуги, которые замыкают цикл
+TEST(TopologicalSortTest, IncrementalMatchesRecompute) {
+    for (int n : {2, 10, 200}) {
+        GraphGenerator generator(n + 13);
+        auto candidates = GraphGenerator::collect([&](auto&& sink) {
+            generator.erdosRenyi(n, 4LL * n, true, sink);
+        });
+        TopologicalSorter sorter(n);
+        ASSERT_TRUE(sorter.enableIncrementalMode());
+        std::vector<std::pair<int, int>> accepted;
+        for (auto [u, v] : candidates) {
+            // Эталон: дуга допустима, если с ней граф остаётся ацикличным
+            TopologicalSorter reference(n);
+            for (auto [a, b] : accepted) {
+                reference.addEdge(a + 1, b + 1);
+            }
+            reference.addEdge(u + 1, v + 1);
+            bool acyclic = reference.sort();
+            
+            ASSERT_EQ(sorter.addEdge(u + 1, v + 1), acyclic) << n << " " << u << " " << v;
+            if (acyclic) {
+                accepted.push_back({u, v});
+            }
+            ASSERT_TRUE(checkOrder(n, accepted, sorter.getOrder())) << n;
+        }
+    }
+}
+
+// ТЕСТ 14: Включение на готовом графе и на графе с циклом
+TEST(TopologicalSortTest, IncrementalEnable) {
+    TopologicalSorter chain(4);
+    chain.addEdge(3, 4);
+    chain.addEdge(2, 3);
+    ASSERT_TRUE(chain.enableIncrementalMode());
+    EXPECT_FALSE(chain.addEdge(4, 2));
+    EXPECT_TRUE(chain.addEdge(4, 1));
+    EXPECT_TRUE(chain.sort());
+    EXPECT_TRUE(checkOrder(4, {{2, 3}, {1, 2}, {3, 0}}, chain.getOrder()));
+    
+    TopologicalSorter cyclic(2);
+    cyclic.addEdge(1, 2);
+    cyclic.addEdge(2, 1);
+    EXPECT_FALSE(cyclic.enableIncrementalMode());
+    EXPECT_FALSE(cyclic.isIncremental());
+}
+
+// ТЕСТ 15: Канонический порядок совпадает с Каном на std::priority_queue
+TEST(TopologicalSortTest, LexicographicMatchesHeap) {
+    for (int n : {1, 63, 64, 65, 4097, 300000}) {
+        GraphGenerator generator(n + 15);
+        auto edges = GraphGenerator::collect([&](auto&& sink) {
+            generator.randomDag(n, 2LL * n, sink);
+        });
+        TopologicalSorter sorter(n);
+        std::vector<std::vector<int>> out(n);
+        std::vector<int> in_degree(n, 0);
+        for (auto [u, v] : edges) {
+            sorter.addEdge(u + 1, v + 1);
+            out[u].push_back(v);
+            in_degree[v]++;
+        }
+        
+        std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+        for (int v = 0; v < n; ++v) {
+            if (in_degree[v] == 0) ready.push(v);
+        }
+        std::vector<int> expected;
+        while (!ready.empty()) {
+            int v = ready.top();
+            ready.pop();
+            expected.push_back(v);
+            for (int w : out[v]) {
+                if (--in_degree[w] == 0) ready.push(w);
+            }
+        }
+        
+        ASSERT_TRUE(sorter.sort(SortAlgorithm::Lexicographic));
+        EXPECT_EQ(sorter.getOrder(), expected) << n;
+    }
+}
+
+// ТЕСТ 16: Канонический порядок на малом примере и при цикле
+TEST(TopologicalSortTest, LexicographicSmall) {
+    TopologicalSorter sorter(5);
+    sorter.addEdge(5, 1);
+    sorter.addEdge(3, 2);
+    sorter.addEdge(4, 2);
+    EXPECT_TRUE(sorter.sort(SortAlgorithm::Lexicographic));
+    EXPECT_EQ(sorter.getOrder(), (std::vector<int>{2, 3, 1, 4, 0}));
+    
+    sorter.addEdge(1, 5);
+    EXPECT_FALSE(sorter.sort(SortAlgorithm::Lexicographic));
+}
+
+// Простой цикл из дуг графа: вершины различны, каждая ведёт в следующую
+bool checkCycle(const std::vector<std::pair<int, int>>& edges, const std::vector<int>& cycle) {
+    if (cycle.empty()) return false;
+    std::vector<int> sorted(cycle);
+    std::sort(sorted.begin(), sorted.end());
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) return false;
+    for (size_t i = 0; i < cycle.size(); ++i) {
+        std::pair<int, int> arc{cycle[i], cycle[(i + 1) % cycle.size()]};
+        if (std::find(edges.begin(), edges.end(), arc) == edges.end()) return false;
+    }
+    return true;
+}
+
+// ТЕСТ 17: Любой алгоритм при неудаче отдаёт настоящий простой цикл
+TEST(TopologicalSortTest, CycleWitness) {
+    for (int n : {1, 6, 300, 5000}) {
+        GraphGenerator generator(n + 17);
+        auto edges = GraphGenerator::collect([&](auto&& sink) {
+            generator.randomDag(n, 2LL * n, sink);
+        });
+        // Петля или обратная дуга к ребру DAG
+        if (edges.empty()) {
+            edges.push_back({0, 0});
+        } else {
+            auto [u, v] = edges[edges.size() / 3];
+            edges.push_back({v, u});
+        }
+        TopologicalSorter sorter(n);
+        for (auto [u, v] : edges) {
+            sorter.addEdge(u + 1, v + 1);
+        }
+        for (SortAlgorithm algorithm : {SortAlgorithm::Dfs, SortAlgorithm::Diagnostic,
+                                        SortAlgorithm::ParallelKahn, SortAlgorithm::Lexicographic}) {
+            ASSERT_FALSE(sorter.sort(algorithm, 2)) << n;
+            EXPECT_TRUE(checkCycle(edges, sorter.getCycle())) << n << " " << static_cast<int>(algorithm);
+        }
+    }
+    
+    TopologicalSorter dag(3);
+    dag.addEdge(1, 2);
+    EXPECT_TRUE(dag.sort(SortAlgorithm::Diagnostic));
+    EXPECT_TRUE(checkOrder(3, {{0, 1}}, dag.getOrder()));
+    EXPECT_TRUE(dag.getCycle().empty());
+    EXPECT_TRUE(dag.getCyclicComponents().empty());
+}
+
+// ТЕСТ 18: Диагностика находит все нетривиальные компоненты за один проход
+TEST(TopologicalSortTest, DiagnosticComponents) {
+    const int n = 60;
+    GraphGenerator generator(18);
+    auto edges = GraphGenerator::collect([&](auto&& sink) {
+        generator.erdosRenyi(n, 70, true, sink);
+    });
+    edges.push_back({5, 5});
+    TopologicalSorter sorter(n);
+    for (auto [u, v] : edges) {
+        sorter.addEdge(u + 1, v + 1);
+    }
+    ASSERT_FALSE(sorter.sort(SortAlgorithm::Diagnostic));
+    EXPECT_TRUE(checkCycle(edges, sorter.getCycle()));
+    
+    // Эталон: транзитивное замыкание
+    std::vector<std::vector<bool>> reach(n, std::vector<bool>(n, false));
+    for (auto [u, v] : edges) reach[u][v] = true;
+    for (int k = 0; k < n; ++k)
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                if (reach[i][k] && reach[k][j]) reach[i][j] = true;
+    std::vector<std::vector<int>> expected;
+    std::vector<bool> taken(n, false);
+    for (int v = 0; v < n; ++v) {
+        if (taken[v] || !reach[v][v]) continue;
+        std::vector<int> component;
+        for (int w = 0; w < n; ++w) {
+            if (w == v || (reach[v][w] && reach[w][v])) {
+                component.push_back(w);
+                taken[w] = true;
+            }
+        }
+        expected.push_back(component);
+    }
+    
+    auto actual = sorter.getCyclicComponents();
+    for (auto& component : actual) std::sort(component.begin(), component.end());
+    std::sort(actual.begin(), actual.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(actual, expected);
+}
+
+// ТЕСТ 19: Исполнитель запускает каждую задачу один раз и только после
+// завершения всех её зависимостей
+TEST(TopologicalSortTest, ExecutorRespectsDependencies) {
+    const int n = 3000;
+    GraphGenerator generator(19);
+    auto edges = GraphGenerator::collect([&](auto&& sink) {
+        generator.randomDag(n, 4LL * n, sink);
+    });
+    TopologicalSorter sorter(n);
+    for (auto [u, v] : edges) {
+        sorter.addEdge(u + 1, v + 1);
+    }
+    DagExecutor executor(sorter);
+    ASSERT_TRUE(executor.isAcyclic());
+    
+    for (int threads : {1, 4}) {
+        std::atomic<int> clock(0);
+        std::vector<int> started(n, -1);
+        std::vector<int> finished(n, -1);
+        std::vector<std::atomic<int>> runs(n);
+        ASSERT_TRUE(executor.run([&](int v) {
+            started[v] = clock++;
+            runs[v]++;
+            finished[v] = clock++;
+        }, threads));
+        
+        for (int v = 0; v < n; ++v) {
+            ASSERT_EQ(runs[v].load(), 1) << v;
+        }
+        for (auto [u, v] : edges) {
+            ASSERT_LT(finished[u], started[v]) << u << " " << v << " " << threads;
+        }
+        const ExecutionStats& stats = executor.getStats();
+        EXPECT_GT(stats.critical_path_tasks, 0);
+        EXPECT_LE(stats.critical_path, stats.total_work);
+    }
+}
+
+// ТЕСТ 20: Критический путь идёт первым, цикл ничего не запускает
+TEST(TopologicalSortTest, ExecutorPriorityAndCycle) {
+    // Вершина 1 одна, 2 -> 3 -> 4 - цепочка; подсказки делают цепочку важнее
+    TopologicalSorter sorter(4);
+    sorter.addEdge(2, 3);
+    sorter.addEdge(3, 4);
+    DagExecutor executor(sorter, {1.0, 1.0, 1.0, 1.0});
+    std::vector<int> order;
+    // Задачи заметной длины, чтобы измеренный критический путь был цепочкой
+    ASSERT_TRUE(executor.run([&](int v) {
+        order.push_back(v);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }, 1));
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 2);
+    EXPECT_EQ(executor.getStats().critical_path_tasks, 3);
+    EXPECT_GE(executor.getStats().available_parallelism, 1.0);
+    
+    // С подсказкой одиночная задача дороже всей цепочки и идёт первой
+    DagExecutor weighted(sorter, {10.0, 1.0, 1.0, 1.0});
+    order.clear();
+    ASSERT_TRUE(weighted.run([&](int v) { order.push_back(v); }, 1));
+    EXPECT_EQ(order.front(), 0);
+    
+    // Подсказок должно быть ровно по одной на вершину
+    EXPECT_THROW(DagExecutor(sorter, {1.0, 1.0}), std::invalid_argument);
+    
+    TopologicalSorter cyclic(2);
+    cyclic.addEdge(1, 2);
+    cyclic.addEdge(2, 1);
+    DagExecutor broken(cyclic);
+    int calls = 0;
+    EXPECT_FALSE(broken.run([&](int) { calls++; }, 2));
+    EXPECT_EQ(calls, 0);
+}
+
+// ТЕСТ 21: На цепочке лишние потоки спят, а не крутятся: процессорное
+// время процесса много меньше времени выполнения
+TEST(TopologicalSortTest, ExecutorIdleWorkersSleep) {
+    const int n = 20;
+    TopologicalSorter sorter(n);
+    for (int v = 1; v < n; ++v) {
+        sorter.addEdge(v, v + 1);
+    }
+    DagExecutor executor(sorter);
+    
+    std::clock_t cpu_start = std::clock();
+    ASSERT_TRUE(executor.run([](int) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }, 4));
+    double cpu = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    
+    EXPECT_EQ(executor.getStats().critical_path_tasks, n);
+    EXPECT_LT(cpu, 0.25 * executor.getStats().wall_time);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
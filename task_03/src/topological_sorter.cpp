@@ -1,41 +1,135 @@
 #include "topological_sorter.hpp"
-#include <iostream>
+#include "bitset_min_queue.hpp"
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "graph_file.hpp"
+#include "perf_stats.hpp"
+#include <unistd.h>
+#include <utility>
 #include <algorithm>
 
 TopologicalSorter::TopologicalSorter(int n) 
     : vertices_count(n),
+      graph_dirty(true),
       has_cycle(false) {
     
-    graph.resize(n);
     visited.assign(n, 0);
 }
 
-void TopologicalSorter::addEdge(int from, int to) {
+TopologicalSorter::TopologicalSorter(CsrGraph dependency_graph)
+    : vertices_count(dependency_graph.getVerticesCount()),
+      graph(std::move(dependency_graph)),
+      graph_dirty(false),
+      has_cycle(false) {
+    
+    visited.assign(vertices_count, 0);
+}
+
+bool TopologicalSorter::addEdge(int from, int to) {
     int u = from - 1;
     int v = to - 1;
     
-    graph[u].push_back(v);
+    if (incremental && !incremental->addEdge(u, v)) {
+        return false;
+    }
+    if (!graph_dirty && edges.empty()) {
+        // Граф задан готовым CSR: восстанавливаем список рёбер перед изменением
+        edges = graph.toEdgeList();
+    }
+    edges.push_back({u, v});
+    graph_dirty = true;
+    return true;
+}
+
+bool TopologicalSorter::enableIncrementalMode() {
+    incremental.reset();
+    if (!sort()) {
+        return false;
+    }
+    incremental = std::make_unique<DynamicTopologicalOrder>(graph, result);
+    return true;
 }
 
 void TopologicalSorter::dfs(int v) {
     if (has_cycle) return;
     
-    visited[v] = 1;
-    
-    for (int to : graph[v]) {
-        if (visited[to] == 0) {
-            dfs(to);
-        } else if (visited[to] == 1) {
-            has_cycle = true;
-            return;
+    struct Visitor : DfsVisitor {
+        std::vector<int>& visited;
+        std::vector<int>& result;
+        int cycle_start = -1;
+        
+        void enter(int u, int) {
+            visited[u] = 1;
         }
+        
+        DfsAction edge(int, int, int to, long long) {
+            if (visited[to] == 0) {
+                return DfsAction::Descend;
+            }
+            if (visited[to] == 2) {
+                return DfsAction::Skip;
+            }
+            // Серая вершина на стеке - найден цикл
+            cycle_start = to;
+            return DfsAction::Stop;
+        }
+        
+        void leave(int u, int) {
+            visited[u] = 2;
+            result.push_back(u);
+        }
+    };
+    
+    Visitor visitor{{}, visited, result};
+    has_cycle = dfs_engine.run(graph, v, visitor);
+    if (has_cycle) {
+        // Стек остался на месте: цикл - его часть от cycle_start до вершины,
+        // где найдена обратная дуга
+        cycleFromStack(visitor.cycle_start);
     }
+}
+
+void TopologicalSorter::cycleFromStack(int start) {
+    auto stack = dfs_engine.getStack();
+    std::size_t from = stack.size();
+    while (stack[--from].vertex != start) {}
+    cycle.clear();
+    for (std::size_t i = from; i < stack.size(); ++i) {
+        cycle.push_back(stack[i].vertex);
+    }
+}
+
+bool TopologicalSorter::sort(SortAlgorithm algorithm, int threads) {
+    if (incremental) {
+        return true;
+    }
+    getGraph();
+    levels.clear();
+    cycle.clear();
+    cyclic_components.clear();
     
-    visited[v] = 2;
-    result.push_back(v);
+    switch (algorithm) {
+        case SortAlgorithm::Dfs:
+            return sortDfs();
+        case SortAlgorithm::Diagnostic:
+            return sortDiagnostic();
+        case SortAlgorithm::ParallelKahn:
+            if (sortParallelKahn(threads)) {
+                return true;
+            }
+            break;
+        case SortAlgorithm::Lexicographic:
+            if (sortLexicographic()) {
+                return true;
+            }
+            break;
+    }
+    findResidualCycle();
+    return false;
 }
 
-bool TopologicalSorter::sort() {
+bool TopologicalSorter::sortDfs() {
+    PERF_PHASE("toposort.dfs");
     result.clear();
     has_cycle = false;
     visited.assign(vertices_count, 0);
@@ -53,33 +147,93 @@ bool TopologicalSorter::sort() {
     return true;
 }
 
+bool TopologicalSorter::sortLexicographic() {
+    PERF_PHASE("toposort.lexicographic");
+    // Входящие степени - в visited, он нужен только DFS
+    std::vector<int>& in_degree = visited;
+    in_degree.assign(vertices_count, 0);
+    for (int v = 0; v < vertices_count; ++v) {
+        for (int w : graph.getNeighbors(v)) {
+            in_degree[w]++;
+        }
+    }
+    
+    BitsetMinQueue ready(vertices_count);
+    for (int v = 0; v < vertices_count; ++v) {
+        if (in_degree[v] == 0) {
+            ready.push(v);
+        }
+    }
+    
+    result.clear();
+    result.reserve(vertices_count);
+    while (!ready.empty()) {
+        int v = ready.pop();
+        result.push_back(v);
+        for (int w : graph.getNeighbors(v)) {
+            if (--in_degree[w] == 0) {
+                ready.push(w);
+            }
+        }
+    }
+    // Вершины на циклах и за ними так и не становятся готовыми
+    return static_cast<int>(result.size()) == vertices_count;
+}
+
+const CsrGraph& TopologicalSorter::getGraph() {
+    if (graph_dirty) {
+        PERF_PHASE("toposort.build");
+        graph = CsrGraph::fromEdges(vertices_count, edges);
+        graph_dirty = false;
+    }
+    return graph;
+}
+
 const std::vector<int>& TopologicalSorter::getOrder() const {
-    return result;
+    return incremental ? incremental->getOrder() : result;
 }
 
-void TopologicalSorter::solveTopologicalSort() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+TopologicalSorter TopologicalSorter::readTextInput() {
+    PERF_PHASE("toposort.read");
+    FastReader input;
     
-    int n, m;
-    std::cin >> n >> m;
+    int n = input.readInt();
+    int m = input.readInt();
     
     TopologicalSorter sorter(n);
     
     for (int i = 0; i < m; ++i) {
-        int u, v;
-        std::cin >> u >> v;
+        int u = input.readInt();
+        int v = input.readInt();
         sorter.addEdge(u, v);
     }
     
+    return sorter;
+}
+
+TopologicalSorter TopologicalSorter::readGraphFile() {
+    GraphFileHeader header;
+    CsrGraph graph = GraphFile::load(STDIN_FILENO, &header);
+    GraphFile::requireLayout(header, 0);
+    return TopologicalSorter(std::move(graph));
+}
+
+void TopologicalSorter::solveTopologicalSort() {
+    FastWriter output;
+    
+    // Бинарный файл графа (см. graph_convert) используется без разбора текста
+    TopologicalSorter sorter = GraphFile::isGraphFile(STDIN_FILENO)
+        ? readGraphFile()
+        : readTextInput();
+    
     if (sorter.sort()) {
         const auto& order = sorter.getOrder();
         for (size_t i = 0; i < order.size(); ++i) {
-            if (i > 0) std::cout << " ";
-            std::cout << order[i] + 1;
+            if (i > 0) output.writeChar(' ');
+            output.writeInt(order[i] + 1);
         }
-        std::cout << "\n";
+        output.writeChar('\n');
     } else {
-        std::cout << "-1\n";
+        output.writeString("-1\n");
     }
 }
\ No newline at end of file
@@ -1,28 +1,105 @@
 #ifndef TOPOLOGICAL_SORTER_HPP
 #define TOPOLOGICAL_SORTER_HPP
 
+#include <memory>
 #include <vector>
+#include <utility>
+#include "csr_graph.hpp"
+#include "dfs_engine.hpp"
+#include "dynamic_topological_order.hpp"
+
+// Алгоритм топологической сортировки
+enum class SortAlgorithm {
+    Dfs,            // обход в глубину (по умолчанию)
+    ParallelKahn,   // Кан по уровням на нескольких потоках, с уровнями вершин
+    Lexicographic,  // канонический: лексикографически наименьший порядок
+    Diagnostic      // DFS Пирса: при цикле - ещё и все нетривиальные компоненты
+};
 
 class TopologicalSorter {
 private:
     int vertices_count;
-    std::vector<std::vector<int>> graph;
+    std::vector<std::pair<int, int>> edges;
+    CsrGraph graph;
+    bool graph_dirty;
     
     std::vector<int> visited;
     std::vector<int> result;
+    std::vector<int> levels;
     bool has_cycle;
     
+    // Свидетельство цикла и нетривиальные компоненты после неудачного sort()
+    std::vector<int> cycle;
+    std::vector<std::vector<int>> cyclic_components;
+    
+    DfsEngine dfs_engine;
+    
+    // Поддерживаемый при добавлении дуг порядок
+    std::unique_ptr<DynamicTopologicalOrder> incremental;
+    
+    // DFS на явном стеке; при обнаружении цикла обход прерывается
     void dfs(int v);
+    bool sortDfs();
+    
+    // Цикл - часть стека dfs_engine от start до вершины на вершине стека
+    void cycleFromStack(int start);
+    
+    // cycle_witness.cpp: DFS Пирса с компонентами и поиск цикла среди
+    // вершин, не попавших в порядок у Кана
+    bool sortDiagnostic();
+    void findResidualCycle();
+    
+    // Кан по уровням (parallel_kahn.cpp); threads <= 0 - по числу ядер
+    bool sortParallelKahn(int threads);
+    
+    // Кан, всегда берущий наименьшую готовую вершину из BitsetMinQueue
+    bool sortLexicographic();
+    
+    static TopologicalSorter readTextInput();
+    // Бинарный файл графа (см. graph_convert)
+    static TopologicalSorter readGraphFile();
     
 public:
     TopologicalSorter(int n);
+    // Готовый ориентированный CSR (например, из бинарного файла)
+    explicit TopologicalSorter(CsrGraph dependency_graph);
     
-    void addEdge(int from, int to);
+    // false - только в инкрементальном режиме: дуга замкнула бы цикл и
+    // не добавлена
+    bool addEdge(int from, int to);
+    
+    // Инкрементальный режим: дальнейшие addEdge поддерживают порядок,
+    // переставляя только затронутый отрезок, и отклоняют дуги, замыкающие
+    // цикл. Включение стоит одного sort(); false, если граф уже с циклом.
+    // sort() в этом режиме ничего не пересчитывает
+    bool enableIncrementalMode();
+    bool isIncremental() const { return incremental != nullptr; }
+    // Текущее состояние; только в инкрементальном режиме
+    const DynamicTopologicalOrder& getIncremental() const { return *incremental; }
 
-    bool sort();
+    // false, если есть цикл. threads учитывается только в ParallelKahn
+    bool sort(SortAlgorithm algorithm = SortAlgorithm::Dfs, int threads = 0);
+    
+    // Простой цикл после sort() == false: c[0] -> c[1] -> ... -> c[k-1] -> c[0],
+    // петля - цикл из одной вершины. DFS находит его тем же проходом, Кан -
+    // обходом только не попавших в порядок вершин
+    const std::vector<int>& getCycle() const { return cycle; }
+    
+    // Компоненты сильной связности из нескольких вершин или с петлёй;
+    // заполняются только SortAlgorithm::Diagnostic
+    const std::vector<std::vector<int>>& getCyclicComponents() const {
+        return cyclic_components;
+    }
 
     const std::vector<int>& getOrder() const;
     
+    // Граф зависимостей, собранный из добавленных дуг
+    const CsrGraph& getGraph();
+    
+    // Уровень каждой вершины (с 0) - длина самого длинного пути к ней из
+    // истока; заполняется только SortAlgorithm::ParallelKahn
+    const std::vector<int>& getLevels() const { return levels; }
+    
     static void solveTopologicalSort();
 };
 
@@ -1,7 +1,12 @@
 #include "johnson_algorithm.hpp"
-#include <iostream>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "graph_file.hpp"
+#include "perf_stats.hpp"
+#include <unistd.h>
 #include <vector>
-#include <queue>
+#include <algorithm>
+#include <functional>
 
 JohnsonAlgorithm::JohnsonAlgorithm(int n) 
     : vertices_count(n) {
@@ -11,17 +16,21 @@ void JohnsonAlgorithm::addEdge(int from, int to, long long weight) {
     edges.push_back({from - 1, to - 1, weight});
 }
 
-bool JohnsonAlgorithm::bellmanFord(int source, std::vector<long long>& distances) const {
-    int n = vertices_count + 1;
-    distances.assign(n, INF);
-    distances[source] = 0;
+bool JohnsonAlgorithm::bellmanFord(std::pmr::vector<long long>& distances) const {
+    // Первая итерация по рёбрам фиктивной вершины даёт всем расстояние 0,
+    // поэтому сами эти рёбра в список не добавляем
+    PERF_PHASE("johnson.bellman_ford");
+    int n = vertices_count;
+    distances.assign(n, 0);
     
     for (int i = 0; i < n - 1; ++i) {
         bool updated = false;
+        PERF_COUNT("johnson.bellman_ford.passes");
+        PERF_COUNT_ADD("johnson.bellman_ford.edges_scanned", edges.size());
         for (const auto& edge : edges) {
-            if (distances[edge.from] < INF && 
-                distances[edge.to] > distances[edge.from] + edge.weight) {
+            if (distances[edge.to] > distances[edge.from] + edge.weight) {
                 distances[edge.to] = distances[edge.from] + edge.weight;
+                PERF_COUNT("johnson.bellman_ford.relaxations");
                 updated = true;
             }
         }
@@ -29,8 +38,7 @@ bool JohnsonAlgorithm::bellmanFord(int source, std::vector<long long>& distances
     }
     
     for (const auto& edge : edges) {
-        if (distances[edge.from] < INF && 
-            distances[edge.to] > distances[edge.from] + edge.weight) {
+        if (distances[edge.to] > distances[edge.from] + edge.weight) {
             return false;
         }
     }
@@ -38,113 +46,185 @@ bool JohnsonAlgorithm::bellmanFord(int source, std::vector<long long>& distances
     return true;
 }
 
-void JohnsonAlgorithm::dijkstra(int source, const std::vector<long long>& h,
-                               std::vector<long long>& distances) const {
+void JohnsonAlgorithm::buildReweightedGraph(const std::pmr::vector<long long>& h,
+                                            ReweightedGraph& reweighted) const {
+    PERF_PHASE("johnson.reweight");
+    // Подсчётом, как CsrGraph: offsets[u + 1] сначала служит курсором строки u
+    auto& offsets = reweighted.offsets;
+    offsets.assign(vertices_count + 2, 0);
+    for (const auto& edge : edges) {
+        offsets[edge.from + 2]++;
+    }
+    for (int u = 0; u < vertices_count; ++u) {
+        offsets[u + 2] += offsets[u + 1];
+    }
+    
+    reweighted.targets.resize(edges.size());
+    reweighted.weights.resize(edges.size());
+    for (const auto& edge : edges) {
+        long long slot = offsets[edge.from + 1]++;
+        reweighted.targets[slot] = edge.to;
+        reweighted.weights[slot] = edge.weight + h[edge.from] - h[edge.to];
+    }
+    offsets.pop_back();
+}
+
+void JohnsonAlgorithm::dijkstra(int source, const ReweightedGraph& reweighted,
+                               std::pmr::vector<long long>& distances,
+                               std::pmr::vector<std::pair<long long, int>>& heap) const {
+    PERF_PHASE("johnson.dijkstra");
     int n = vertices_count;
     distances.assign(n, INF);
     distances[source] = 0;
     
+    // Та же куча, что у std::priority_queue, но с внешним буфером
     using Pair = std::pair<long long, int>;
-    std::priority_queue<Pair, std::vector<Pair>, std::greater<Pair>> pq;
-    pq.push({0, source});
-    
-    std::vector<std::vector<Pair>> adj(n);
-    for (const auto& edge : edges) {
-        if (h[edge.from] < INF && h[edge.to] < INF) {
-            long long new_weight = edge.weight + h[edge.from] - h[edge.to];
-            adj[edge.from].push_back({new_weight, edge.to});
-        }
-    }
-    
-    while (!pq.empty()) {
-        auto [current_dist, u] = pq.top();
-        pq.pop();
+    std::greater<Pair> later;
+    heap.clear();
+    heap.push_back({0, source});
+    
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        auto [current_dist, u] = heap.back();
+        heap.pop_back();
         
         if (current_dist > distances[u]) continue;
         
-        for (const auto& [weight, v] : adj[u]) {
-            long long new_dist = current_dist + weight;
+        for (long long i = reweighted.offsets[u]; i < reweighted.offsets[u + 1]; ++i) {
+            int v = reweighted.targets[i];
+            long long new_dist = current_dist + reweighted.weights[i];
             if (new_dist < distances[v]) {
                 distances[v] = new_dist;
-                pq.push({new_dist, v});
+                heap.push_back({new_dist, v});
+                std::push_heap(heap.begin(), heap.end(), later);
+                PERF_COUNT("johnson.dijkstra.heap_pushes");
             }
         }
     }
 }
 
 std::vector<std::vector<long long>> JohnsonAlgorithm::findAllShortestPaths() {
+    ScratchWorkspace workspace;
+    return findAllShortestPaths(workspace);
+}
+
+std::vector<std::vector<long long>> JohnsonAlgorithm::findAllShortestPaths(ScratchWorkspace& workspace) {
     int n = vertices_count;
-    
-    int dummy_vertex = n;
-    
-    auto original_edges = edges;
-    
-    for (int v = 0; v < n; ++v) {
-        edges.push_back({dummy_vertex, v, 0});
+    std::vector<long long> distances;
+    if (!findAllShortestPaths(workspace, distances)) {
+        return {};
     }
     
-    std::vector<long long> h(n + 1, 0); // Потенциалы (+1 для фиктивной)
-    bool has_negative_cycle = !bellmanFord(dummy_vertex, h);
-    
-    edges = original_edges;
+    std::vector<std::vector<long long>> result(n);
+    for (int u = 0; u < n; ++u) {
+        result[u].assign(distances.begin() + static_cast<long long>(u) * n,
+                         distances.begin() + static_cast<long long>(u + 1) * n);
+    }
+    return result;
+}
+
+bool JohnsonAlgorithm::findAllShortestPaths(ScratchWorkspace& workspace,
+                                            std::vector<long long>& distances) {
+    int n = vertices_count;
+    workspace.reset();
     
-    if (has_negative_cycle) {
-        return {};
+    auto h = workspace.makeVector<long long>(0); // Потенциалы
+    if (!bellmanFord(h)) {
+        distances.clear();
+        return false;
     }
     
-    h.pop_back();
+    ReweightedGraph reweighted{
+        workspace.makeVector<long long>(0),
+        workspace.makeVector<int>(0),
+        workspace.makeVector<long long>(0)
+    };
+    buildReweightedGraph(h, reweighted);
+    
+    distances.assign(static_cast<std::size_t>(n) * n, INF);
     
-    std::vector<std::vector<long long>> result(n, std::vector<long long>(n, INF));
+    auto dist = workspace.makeVector<long long>(n);
+    std::pmr::vector<std::pair<long long, int>> heap(workspace.getResource());
+    heap.reserve(n + 1);
     
     for (int u = 0; u < n; ++u) {
-        std::vector<long long> dist;
-        dijkstra(u, h, dist);
+        dijkstra(u, reweighted, dist, heap);
         
+        long long* row = distances.data() + static_cast<std::size_t>(u) * n;
         for (int v = 0; v < n; ++v) {
             if (dist[v] < INF) {
-                if (h[u] < INF && h[v] < INF && dist[v] < INF) {
-                    result[u][v] = dist[v] - h[u] + h[v];
-                }
+                row[v] = dist[v] - h[u] + h[v];
             }
         }
-        result[u][u] = 0;
+        row[u] = 0;
     }
     
-    return result;
+    return true;
 }
 
-void JohnsonAlgorithm::solveJohnsonAlgorithm() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+JohnsonAlgorithm JohnsonAlgorithm::readTextInput() {
+    PERF_PHASE("johnson.read");
+    FastReader input;
     
-    int n, m;
-    std::cin >> n >> m;
+    int n = input.readInt();
+    int m = input.readInt();
     
     JohnsonAlgorithm solver(n);
     
     for (int i = 0; i < m; ++i) {
-        int u, v;
-        long long w;
-        std::cin >> u >> v >> w;
+        int u = input.readInt();
+        int v = input.readInt();
+        long long w = input.readLong();
         solver.addEdge(u, v, w);
     }
     
+    return solver;
+}
+
+JohnsonAlgorithm JohnsonAlgorithm::readGraphFile() {
+    PERF_PHASE("johnson.read");
+    GraphFileHeader header;
+    CsrGraph graph = GraphFile::load(STDIN_FILENO, &header);
+    GraphFile::requireLayout(header, GraphFile::Weighted);
+    JohnsonAlgorithm solver(graph.getVerticesCount());
+    solver.edges.reserve(graph.getEdgesCount());
+    
+    for (int u = 0; u < graph.getVerticesCount(); ++u) {
+        auto neighbors = graph.getNeighbors(u);
+        auto weights = graph.getWeights(u);
+        for (size_t i = 0; i < neighbors.size(); ++i) {
+            solver.edges.push_back({u, neighbors[i], weights[i]});
+        }
+    }
+    
+    return solver;
+}
+
+void JohnsonAlgorithm::solveJohnsonAlgorithm() {
+    FastWriter output;
+    
+    JohnsonAlgorithm solver = GraphFile::isGraphFile(STDIN_FILENO)
+        ? readGraphFile()
+        : readTextInput();
+    int n = solver.vertices_count;
+    
     auto distances = solver.findAllShortestPaths();
     
     if (distances.empty()) {
-        std::cout << "-1\n";
+        output.writeString("-1\n");
         return;
     }
     
+    PERF_PHASE("johnson.write");
     for (int i = 0; i < n; ++i) {
         for (int j = 0; j < n; ++j) {
-            if (j > 0) std::cout << " ";
+            if (j > 0) output.writeChar(' ');
             if (distances[i][j] >= INF / 2) {
-                std::cout << "INF";
+                output.writeString("INF");
             } else {
-                std::cout << distances[i][j];
+                output.writeInt(distances[i][j]);
             }
         }
-        std::cout << "\n";
+        output.writeChar('\n');
     }
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <limits>
+#include <memory_resource>
+#include <utility>
+#include "arena.hpp"
 
 class JohnsonAlgorithm {
 private:
@@ -16,10 +19,27 @@ private:
     
     std::vector<Edge> edges;
     
-    bool bellmanFord(int source, std::vector<long long>& distances) const;
+    // Беллман - Форд от фиктивной вершины, соединённой со всеми рёбрами веса 0
+    bool bellmanFord(std::pmr::vector<long long>& distances) const;
     
-    void dijkstra(int source, const std::vector<long long>& h, 
-                  std::vector<long long>& distances) const;
+    // Граф с перевзвешенными рёбрами w + h[u] - h[v] в CSR; массивы
+    // лежат в рабочей памяти, поэтому не CsrGraph
+    struct ReweightedGraph {
+        std::pmr::vector<long long> offsets;
+        std::pmr::vector<int> targets;
+        std::pmr::vector<long long> weights;
+    };
+    
+    void buildReweightedGraph(const std::pmr::vector<long long>& h, ReweightedGraph& reweighted) const;
+    
+    // heap - бинарная куча, её память переиспользуется между запусками
+    void dijkstra(int source, const ReweightedGraph& reweighted, 
+                  std::pmr::vector<long long>& distances,
+                  std::pmr::vector<std::pair<long long, int>>& heap) const;
+    
+    static JohnsonAlgorithm readTextInput();
+    // Бинарный файл графа (см. graph_convert): рёбра берутся из CSR без разбора текста
+    static JohnsonAlgorithm readGraphFile();
     
 public:
     JohnsonAlgorithm(int n);
@@ -27,6 +47,14 @@ public:
     void addEdge(int from, int to, long long weight);
     
     std::vector<std::vector<long long>> findAllShortestPaths();
+    // То же, но временные массивы берутся из workspace; сама матрица
+    // ответа выделяется заново
+    std::vector<std::vector<long long>> findAllShortestPaths(ScratchWorkspace& workspace);
+    // Матрица ответа построчно в distances (n * n, расстояние u -> v в
+    // u * n + v); false - отрицательный цикл. Ёмкость distances и workspace
+    // переиспользуется, так что повторные вызовы на том же графе не
+    // выделяют память в куче
+    bool findAllShortestPaths(ScratchWorkspace& workspace, std::vector<long long>& distances);
     
     static void solveJohnsonAlgorithm();
     
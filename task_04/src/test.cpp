@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "johnson_algorithm.hpp"
+#include "heap_counter.hpp"
+#include <algorithm>
 #include <vector>
 
 // Тест 1: Граф с одной вершиной
@@ -150,6 +152,40 @@ TEST(JohnsonAlgorithmTest, IsolatedVertex) {
     EXPECT_EQ(distances[2][2], 0); // 3->3 = 0
 }
 
+// Повторные запросы с одной рабочей памятью не выделяют новых блоков
+TEST(JohnsonAlgorithmTest, WorkspaceReuseWithoutAllocations) {
+    JohnsonAlgorithm solver(50);
+    for (int i = 1; i <= 50; ++i) {
+        solver.addEdge(i, i % 50 + 1, i % 7 - 2);
+        solver.addEdge(i, (i * 7) % 50 + 1, 10);
+    }
+    
+    ScratchWorkspace workspace;
+    auto first = solver.findAllShortestPaths(workspace);
+    auto second = solver.findAllShortestPaths(workspace);
+    size_t warm_allocations = workspace.getUpstreamAllocations();
+    auto third = solver.findAllShortestPaths(workspace);
+    
+    ASSERT_FALSE(first.empty());
+    EXPECT_EQ(first, solver.findAllShortestPaths());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first, third);
+    EXPECT_EQ(workspace.getUpstreamAllocations(), warm_allocations);
+    
+    // С буфером ответа после прогрева куча не трогается вовсе
+    std::vector<long long> distances;
+    ASSERT_TRUE(solver.findAllShortestPaths(workspace, distances));
+    long long before = getHeapAllocations();
+    bool found = solver.findAllShortestPaths(workspace, distances);
+    EXPECT_EQ(getHeapAllocations(), before);
+    solver.findAllShortestPaths(workspace);
+    EXPECT_GT(getHeapAllocations(), before);
+    ASSERT_TRUE(found);
+    for (int u = 0; u < 50; ++u) {
+        EXPECT_TRUE(std::equal(first[u].begin(), first[u].end(), distances.begin() + u * 50));
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,5 +1,9 @@
 #include "mst.hpp"
-#include <iostream>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "graph_file.hpp"
+#include "perf_stats.hpp"
+#include <unistd.h>
 #include <vector>
 #include <algorithm>
 #include <tuple>
@@ -36,7 +40,11 @@ int LimitedDegreeMST::findLimitedDegreeMST() {
         }
     }
 
-    std::sort(all_edges.begin(), all_edges.end());
+    {
+        PERF_PHASE("mst.sort_edges");
+        std::sort(all_edges.begin(), all_edges.end());
+    }
+    PERF_PHASE("mst.kruskal");
 
     std::vector<int> parent(n);
     std::vector<int> rank(n, 0);
@@ -102,26 +110,60 @@ int LimitedDegreeMST::findLimitedDegreeMST() {
     return mst_weight;
 }
 
-void LimitedDegreeMST::solveLimitedDegreeMST() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+LimitedDegreeMST LimitedDegreeMST::readTextInput() {
+    PERF_PHASE("mst.read");
+    FastReader input;
     
-    int n, m, d;
-    std::cin >> n >> m >> d;
+    int n = input.readInt();
+    int m = input.readInt();
+    int d = input.readInt();
     
     LimitedDegreeMST solver(n, d);
     
     for (int i = 0; i < m; ++i) {
-        int u, v, w;
-        std::cin >> u >> v >> w;
+        int u = input.readInt();
+        int v = input.readInt();
+        int w = input.readInt();
         solver.addEdge(u, v, w);
     }
     
+    return solver;
+}
+
+LimitedDegreeMST LimitedDegreeMST::readGraphFile() {
+    PERF_PHASE("mst.read");
+    GraphFileHeader header;
+    CsrGraph graph = GraphFile::load(STDIN_FILENO, &header);
+    GraphFile::requireLayout(header, GraphFile::Undirected | GraphFile::Weighted);
+    LimitedDegreeMST solver(graph.getVerticesCount(), static_cast<int>(header.parameter));
+    
+    // Неориентированное ребро лежит в CSR дважды, берём копию с u < v
+    for (int u = 0; u < graph.getVerticesCount(); ++u) {
+        auto neighbors = graph.getNeighbors(u);
+        auto weights = graph.getWeights(u);
+        for (size_t i = 0; i < neighbors.size(); ++i) {
+            if (u < neighbors[i]) {
+                solver.addEdge(u + 1, neighbors[i] + 1, static_cast<int>(weights[i]));
+            }
+        }
+    }
+    
+    return solver;
+}
+
+void LimitedDegreeMST::solveLimitedDegreeMST() {
+    FastWriter output;
+    
+    LimitedDegreeMST solver = GraphFile::isGraphFile(STDIN_FILENO)
+        ? readGraphFile()
+        : readTextInput();
+    
     int result = solver.findLimitedDegreeMST();
     
     if (result == -1) {
-        std::cout << "Невозможно построить остовное дерево с заданным ограничением степени\n";
+        output.writeString("Невозможно построить остовное дерево с заданным ограничением степени\n");
     } else {
-        std::cout << result << "\n";
+        output.writeInt(result);
+        output.writeChar('\n');
     }
 }
\ No newline at end of file
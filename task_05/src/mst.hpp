@@ -16,6 +16,10 @@ private:
     
     std::vector<std::vector<Edge>> graph;
     
+    static LimitedDegreeMST readTextInput();
+    // Бинарный файл графа (см. graph_convert): d хранится в заголовке
+    static LimitedDegreeMST readGraphFile();
+    
 public:
     LimitedDegreeMST(int n, int d);
 
@@ -1,14 +1,18 @@
 #include "max_flow_solver.hpp"
-#include <iostream>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "graph_file.hpp"
+#include "perf_stats.hpp"
+#include <unistd.h>
 #include <vector>
 #include <queue>
 #include <algorithm>
 #include <limits>
 
 MaxFlowSolver::MaxFlowSolver(int n) 
-    : vertices_count(n) {
+    : vertices_count(n),
+      graph_dirty(true) {
     
-    graph.resize(n);
     level.resize(n);
     ptr.resize(n);
 }
@@ -17,28 +21,56 @@ void MaxFlowSolver::addEdge(int from, int to, int capacity) {
     int u = from - 1;
     int v = to - 1;
     
-    Edge forward = {v, capacity, 0, (int)graph[v].size()};
-    Edge backward = {u, 0, 0, (int)graph[u].size()};
+    arcs.push_back({u, v});
+    arc_capacity.push_back(capacity);
+    arcs.push_back({v, u});
+    arc_capacity.push_back(0);
     
-    graph[u].push_back(forward);
-    graph[v].push_back(backward);
+    graph_dirty = true;
+}
+
+void MaxFlowSolver::buildResidualNetwork() {
+    PERF_PHASE("max_flow.build");
+    graph = CsrGraph::fromEdges(vertices_count, arcs, false, true);
+    
+    auto arc_ids = graph.getAllEdgeIds();
+    std::vector<long long> position(arc_ids.size());
+    for (size_t i = 0; i < arc_ids.size(); ++i) {
+        position[arc_ids[i]] = i;
+    }
+    
+    capacity.resize(arc_ids.size());
+    rev.resize(arc_ids.size());
+    flow.assign(arc_ids.size(), 0);
+    
+    for (size_t i = 0; i < arc_ids.size(); ++i) {
+        capacity[i] = arc_capacity[arc_ids[i]];
+        rev[i] = position[arc_ids[i] ^ 1];
+    }
+    
+    graph_dirty = false;
 }
 
 bool MaxFlowSolver::bfs(int source, int sink) {
+    PERF_PHASE("max_flow.bfs");
+    PERF_COUNT("max_flow.bfs_phases");
     std::fill(level.begin(), level.end(), -1);
     std::queue<int> q;
     
     level[source] = 0;
     q.push(source);
     
+    auto targets = graph.getTargets();
+    
     while (!q.empty()) {
         int v = q.front();
         q.pop();
         
-        for (const Edge& edge : graph[v]) {
-            if (level[edge.to] < 0 && edge.flow < edge.capacity) {
-                level[edge.to] = level[v] + 1;
-                q.push(edge.to);
+        for (long long i = graph.getOffset(v); i < graph.getOffset(v + 1); ++i) {
+            int to = targets[i];
+            if (level[to] < 0 && flow[i] < capacity[i]) {
+                level[to] = level[v] + 1;
+                q.push(to);
             }
         }
     }
@@ -46,26 +78,52 @@ bool MaxFlowSolver::bfs(int source, int sink) {
     return level[sink] >= 0;
 }
 
-int MaxFlowSolver::dfs(int v, int sink, int flow) {
-    if (v == sink || flow == 0) {
-        return flow;
-    }
-    
-    for (int& i = ptr[v]; i < (int)graph[v].size(); ++i) {
-        Edge& edge = graph[v][i];
+int MaxFlowSolver::dfs(int source, int sink) {
+    // Текущая дуга вершины хранится в ptr и переживает запуски внутри фазы
+    struct Visitor : DfsVisitor {
+        const CsrGraph& graph;
+        const std::vector<int>& level;
+        const std::vector<int>& capacity;
+        const std::vector<int>& flow;
+        std::vector<long long>& ptr;
+        int sink;
+        
+        long long firstSlot(const CsrGraph&, int v) {
+            return ptr[v];
+        }
         
-        if (level[edge.to] == level[v] + 1 && edge.flow < edge.capacity) {
-            int pushed = dfs(edge.to, sink, std::min(flow, edge.capacity - edge.flow));
-            
-            if (pushed > 0) {
-                edge.flow += pushed;
-                graph[edge.to][edge.rev].flow -= pushed;
-                return pushed;
+        DfsAction edge(int v, int, int to, long long i) {
+            if (level[to] != level[v] + 1 || flow[i] >= capacity[i]) {
+                return DfsAction::Skip;
             }
+            return to == sink ? DfsAction::Stop : DfsAction::Descend;
         }
+        
+        void leave(int v, int) {
+            // Тупик: из v больше нет пути до стока в этой фазе
+            ptr[v] = graph.getOffset(v + 1);
+        }
+    };
+    
+    Visitor visitor{{}, graph, level, capacity, flow, ptr, sink};
+    if (!dfs_engine.run(graph, source, visitor)) {
+        return 0;
+    }
+    
+    auto path = dfs_engine.getStack();
+    PERF_COUNT("max_flow.augmenting_paths");
+    PERF_COUNT_ADD("max_flow.augmenting_path_edges", path.size());
+    int pushed = std::numeric_limits<int>::max();
+    for (const DfsFrame& frame : path) {
+        ptr[frame.vertex] = frame.cursor;
+        pushed = std::min(pushed, capacity[frame.cursor] - flow[frame.cursor]);
+    }
+    for (const DfsFrame& frame : path) {
+        flow[frame.cursor] += pushed;
+        flow[rev[frame.cursor]] -= pushed;
     }
     
-    return 0;
+    return pushed;
 }
 
 int MaxFlowSolver::findMaxFlow(int source, int sink) {
@@ -74,12 +132,19 @@ int MaxFlowSolver::findMaxFlow(int source, int sink) {
     int s = source - 1;
     int t = sink - 1;
     
+    if (graph_dirty) {
+        buildResidualNetwork();
+    }
+    
     int max_flow = 0;
     
     while (bfs(s, t)) {
-        std::fill(ptr.begin(), ptr.end(), 0);
+        for (int v = 0; v < vertices_count; ++v) {
+            ptr[v] = graph.getOffset(v);
+        }
         
-        while (int pushed = dfs(s, t, std::numeric_limits<int>::max())) {
+        PERF_PHASE("max_flow.blocking_flow");
+        while (int pushed = dfs(s, t)) {
             max_flow += pushed;
         }
     }
@@ -87,21 +152,53 @@ int MaxFlowSolver::findMaxFlow(int source, int sink) {
     return max_flow;
 }
 
-void MaxFlowSolver::solveMaxFlow() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+MaxFlowSolver MaxFlowSolver::readTextInput() {
+    PERF_PHASE("max_flow.read");
+    FastReader input;
     
-    int n, m;
-    std::cin >> n >> m;
+    int n = input.readInt();
+    int m = input.readInt();
     
     MaxFlowSolver solver(n);
     
     for (int i = 0; i < m; ++i) {
-        int u, v, c;
-        std::cin >> u >> v >> c;
+        int u = input.readInt();
+        int v = input.readInt();
+        int c = input.readInt();
         solver.addEdge(u, v, c);
     }
     
-    int result = solver.findMaxFlow(1, n);
-    std::cout << result << "\n";
+    return solver;
+}
+
+MaxFlowSolver MaxFlowSolver::readGraphFile() {
+    PERF_PHASE("max_flow.read");
+    GraphFileHeader header;
+    CsrGraph graph = GraphFile::load(STDIN_FILENO, &header);
+    GraphFile::requireLayout(header, GraphFile::Weighted);
+    MaxFlowSolver solver(graph.getVerticesCount());
+    solver.arcs.reserve(2 * graph.getEdgesCount());
+    solver.arc_capacity.reserve(2 * graph.getEdgesCount());
+    
+    for (int u = 0; u < graph.getVerticesCount(); ++u) {
+        auto neighbors = graph.getNeighbors(u);
+        auto capacities = graph.getWeights(u);
+        for (size_t i = 0; i < neighbors.size(); ++i) {
+            solver.addEdge(u + 1, neighbors[i] + 1, static_cast<int>(capacities[i]));
+        }
+    }
+    
+    return solver;
+}
+
+void MaxFlowSolver::solveMaxFlow() {
+    FastWriter output;
+    
+    MaxFlowSolver solver = GraphFile::isGraphFile(STDIN_FILENO)
+        ? readGraphFile()
+        : readTextInput();
+    
+    int result = solver.findMaxFlow(1, solver.vertices_count);
+    output.writeInt(result);
+    output.writeChar('\n');
 }
\ No newline at end of file
@@ -2,25 +2,41 @@
 #define MAX_FLOW_SOLVER_HPP
 
 #include <vector>
+#include <utility>
+#include "csr_graph.hpp"
+#include "dfs_engine.hpp"
 
 class MaxFlowSolver {
 private:
     int vertices_count;
     
-    struct Edge {
-        int to;
-        int capacity;
-        int flow;
-        int rev;
-    };
+    // Дуги в порядке добавления: 2i - прямая, 2i + 1 - обратная
+    std::vector<std::pair<int, int>> arcs;
+    std::vector<int> arc_capacity;
+    
+    // Остаточная сеть в формате CSR, массивы индексируются позицией дуги
+    CsrGraph graph;
+    std::vector<int> capacity;
+    std::vector<int> flow;
+    std::vector<long long> rev;
+    bool graph_dirty;
     
-    std::vector<std::vector<Edge>> graph;
     std::vector<int> level;
-    std::vector<int> ptr;
+    std::vector<long long> ptr;
+    
+    DfsEngine dfs_engine;
+    
+    void buildResidualNetwork();
     
     bool bfs(int source, int sink);
     
-    int dfs(int v, int sink, int flow);
+    // Ищет один путь в слоистой сети и проталкивает по нему поток;
+    // возвращает протолкнутую величину (0, если пути нет)
+    int dfs(int source, int sink);
+    
+    static MaxFlowSolver readTextInput();
+    // Бинарный файл графа (см. graph_convert): веса CSR - пропускные способности
+    static MaxFlowSolver readGraphFile();
     
 public:
     MaxFlowSolver(int n);
@@ -32,4 +48,4 @@ public:
     static void solveMaxFlow();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "max_flow_solver.hpp"
+#include "perf_stats.hpp"
 
 // Вспомогательная функция для создания графа
 MaxFlowSolver createSolver(int n, const std::vector<std::tuple<int, int, int>>& edges) {
@@ -160,4 +161,25 @@ TEST(MaxFlowTest, BipartiteGraph) {
     });
     
     EXPECT_EQ(solver.findMaxFlow(1, 6), 5);
-}
\ No newline at end of file
+}
+
+#ifdef PERF_STATS_ENABLED
+// Счётчики есть только в сборке с -DPERF_STATS=ON
+TEST(MaxFlowTest, PerfCountersTrackPhasesAndPaths) {
+    // Два непересекающихся пути 1-2-4 и 1-3-4
+    auto solver = createSolver(4, {
+        {1, 2, 3},
+        {2, 4, 3},
+        {1, 3, 2},
+        {3, 4, 2}
+    });
+    
+    PerfStats::reset();
+    EXPECT_EQ(solver.findMaxFlow(1, 4), 5);
+    
+    EXPECT_EQ(PerfStats::counter("max_flow.augmenting_paths").value, 2);
+    EXPECT_EQ(PerfStats::counter("max_flow.augmenting_path_edges").value, 4);
+    EXPECT_EQ(PerfStats::counter("max_flow.bfs_phases").value, 2);
+    EXPECT_NE(PerfStats::report().find("\"max_flow.bfs\": {\"calls\": 2"), std::string::npos);
+}
+#endif
@@ -1,5 +1,7 @@
 #include "segment_tree_rmq.hpp"
-#include <iostream>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "perf_stats.hpp"
 #include <vector>
 #include <algorithm>
 #include <limits>
@@ -8,6 +10,7 @@ SegmentTreeRMQ::SegmentTreeRMQ(const std::vector<int>& array) {
     n = array.size();
     arr = array;
     tree.resize(4 * n);
+    PERF_PHASE("rmq.build");
     build(1, 0, n - 1);
 }
 
@@ -40,6 +43,7 @@ void SegmentTreeRMQ::update(int node, int left, int right, int idx, int value) {
 }
 
 int SegmentTreeRMQ::query(int node, int left, int right, int ql, int qr) {
+    PERF_COUNT("rmq.query_nodes");
     if (ql > right || qr < left) {
         return std::numeric_limits<int>::max();
     }
@@ -55,38 +59,45 @@ int SegmentTreeRMQ::query(int node, int left, int right, int ql, int qr) {
 }
 
 void SegmentTreeRMQ::pointUpdate(int idx, int value) {
+    PERF_COUNT("rmq.updates");
     update(1, 0, n - 1, idx - 1, value);
 }
 
 int SegmentTreeRMQ::rangeMinQuery(int l, int r) {
+    PERF_COUNT("rmq.queries");
     return query(1, 0, n - 1, l - 1, r - 1);
 }
 
 void SegmentTreeRMQ::solveRMQ() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+    FastReader input;
+    FastWriter output;
     
-    int N, Q;
-    std::cin >> N >> Q;
+    int N = input.readInt();
+    int Q = input.readInt();
     
     std::vector<int> arr(N);
-    for (int i = 0; i < N; ++i) {
-        std::cin >> arr[i];
+    {
+        PERF_PHASE("rmq.read");
+        for (int i = 0; i < N; ++i) {
+            arr[i] = input.readInt();
+        }
     }
     
     SegmentTreeRMQ segtree(arr);
     
+    // Запросы читаются и выполняются вперемешку, поэтому одна общая фаза
+    PERF_PHASE("rmq.process");
     for (int q = 0; q < Q; ++q) {
-        int type;
-        std::cin >> type;
+        int type = input.readInt();
         
         if (type == 1) {
-            int l, r;
-            std::cin >> l >> r;
-            std::cout << segtree.rangeMinQuery(l, r) << "\n";
+            int l = input.readInt();
+            int r = input.readInt();
+            output.writeInt(segtree.rangeMinQuery(l, r));
+            output.writeChar('\n');
         } else if (type == 2) {
-            int i, x;
-            std::cin >> i >> x;
+            int i = input.readInt();
+            int x = input.readInt();
             segtree.pointUpdate(i, x);
         }
     }
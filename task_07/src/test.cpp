@@ -3,6 +3,12 @@
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <limits>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
 
 // Тест 1: Простой массив, запросы без обновлений
 TEST(SegmentTreeRMQTest, SimpleQueriesNoUpdates) {
@@ -207,6 +213,80 @@ TEST(SegmentTreeRMQTest, OverlappingQueries) {
     EXPECT_EQ(tree.rangeMinQuery(5, 8), 4); // [9,10,4,6]
 }
 
+// Тест 11: Разбор входа через mmap (обычный файл)
+TEST(FastReaderTest, MappedFile) {
+    char path[] = "/tmp/fast_reader_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    std::string data = "5 -3\n  123456789012 -2147483648\r\n+7 0 99999999";
+    ASSERT_EQ(write(fd, data.data(), data.size()), (ssize_t)data.size());
+    close(fd);
+    
+    {
+        FastReader input{std::string(path)};
+        EXPECT_TRUE(input.isMapped());
+        EXPECT_EQ(input.readInt(), 5);
+        EXPECT_EQ(input.readInt(), -3);
+        EXPECT_EQ(input.readLong(), 123456789012LL);
+        EXPECT_EQ(input.readInt(), -2147483648);
+        EXPECT_EQ(input.readInt(), 7);
+        EXPECT_EQ(input.readInt(), 0);
+        EXPECT_EQ(input.readInt(), 99999999);
+        EXPECT_FALSE(input.skipSpaces());
+    }
+    std::remove(path);
+}
+
+// Тест 12: Чтение из канала блоками
+TEST(FastReaderTest, PipeInput) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    std::string data = "1 2 3\n-40000000000 17";
+    ASSERT_EQ(write(fds[1], data.data(), data.size()), (ssize_t)data.size());
+    close(fds[1]);
+    
+    FastReader input(fds[0]);
+    EXPECT_FALSE(input.isMapped());
+    EXPECT_EQ(input.readInt(), 1);
+    EXPECT_EQ(input.readInt(), 2);
+    EXPECT_EQ(input.readInt(), 3);
+    EXPECT_EQ(input.readLong(), -40000000000LL);
+    EXPECT_EQ(input.readInt(), 17);
+    EXPECT_FALSE(input.skipSpaces());
+    close(fds[0]);
+}
+
+// Тест 13: Буферизованный вывод чисел
+TEST(FastWriterTest, FormatsIntegers) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    
+    {
+        FastWriter output(fds[1], FastWriter::FlushPolicy::OnFull, 32);
+        output.writeInt(0);
+        output.writeChar(' ');
+        output.writeInt(-7);
+        output.writeChar(' ');
+        output.writeInt(std::numeric_limits<long long>::min());
+        output.writeChar(' ');
+        output.writeInt(std::numeric_limits<unsigned long long>::max());
+        output.writeString("\nINF 1234567890\n");
+    }
+    close(fds[1]);
+    
+    std::string expected = "0 -7 -9223372036854775808 18446744073709551615\nINF 1234567890\n";
+    std::string actual(expected.size() + 1, '\0');
+    ssize_t total = 0;
+    while (ssize_t got = read(fds[0], actual.data() + total, actual.size() - total)) {
+        if (got < 0) break;
+        total += got;
+    }
+    close(fds[0]);
+    
+    actual.resize(total);
+    EXPECT_EQ(actual, expected);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
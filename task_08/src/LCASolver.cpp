@@ -1,33 +1,49 @@
 #include "LCASolver.hpp"
-#include <iostream>
+#include "fast_input.hpp"
+#include "fast_output.hpp"
+#include "perf_stats.hpp"
 #include <vector>
 #include <cmath>
 #include <algorithm>
 
 LCASolver::LCASolver(int vertices) : n(vertices) {
-    graph.resize(n + 1);
     parent.resize(n + 1, 0);
     first.resize(n + 1, -1);
 }
 
 void LCASolver::addEdge(int u, int v) {
-    graph[u].push_back(v);
-    graph[v].push_back(u);
+    edges.push_back({u, v});
 }
 
-void LCASolver::dfs(int u, int p, int d) {
-    parent[u] = p;
-    first[u] = euler_tour.size();
-    euler_tour.push_back(u);
-    depth.push_back(d);
-    
-    for (int v : graph[u]) {
-        if (v != p) {
-            dfs(v, u, d + 1);
+void LCASolver::dfs(int root) {
+    struct Visitor : DfsVisitor {
+        std::vector<int>& euler_tour;
+        std::vector<int>& depth;
+        std::vector<int>& first;
+        std::vector<int>& parent;
+        
+        void enter(int u, int p) {
+            int d = p < 0 ? 0 : depth[first[p]] + 1;
+            parent[u] = p < 0 ? 0 : p;
+            first[u] = euler_tour.size();
             euler_tour.push_back(u);
             depth.push_back(d);
         }
-    }
+        
+        DfsAction edge(int, int, int v, long long) {
+            // Уже посещённые вершины пропускаем, чтобы лишние рёбра не зациклили обход
+            return first[v] == -1 ? DfsAction::Descend : DfsAction::Skip;
+        }
+        
+        void retreat(int u, int, long long) {
+            euler_tour.push_back(u);
+            depth.push_back(depth[first[u]]);
+        }
+    };
+    
+    Visitor visitor{{}, euler_tour, depth, first, parent};
+    DfsEngine engine;
+    engine.run(graph, root, visitor);
 }
 
 void LCASolver::buildSparseTable() {
@@ -71,9 +87,12 @@ int LCASolver::rmq(int l, int r) const {
 }
 
 void LCASolver::build(int root) {
+    PERF_PHASE("lca.build");
+    graph = CsrGraph::fromEdges(n + 1, edges, true);
+    first.assign(n + 1, -1);
     euler_tour.clear();
     depth.clear();
-    dfs(root, 0, 0);
+    dfs(root);
     buildSparseTable();
 }
 
@@ -87,25 +106,30 @@ int LCASolver::findLCA(int u, int v) const {
 }
 
 void LCASolver::solveLCA() {
-    std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
+    FastReader input;
+    FastWriter output;
     
-    int n, m;
-    std::cin >> n >> m;
+    int n = input.readInt();
+    int m = input.readInt();
     
     LCASolver solver(n);
     
-    for (int i = 2; i <= n; ++i) {
-        int parent;
-        std::cin >> parent;
-        solver.addEdge(i, parent);
+    {
+        PERF_PHASE("lca.read");
+        for (int i = 2; i <= n; ++i) {
+            int parent = input.readInt();
+            solver.addEdge(i, parent);
+        }
     }
     
     solver.build(1);
     
+    PERF_PHASE("lca.queries");
+    PERF_COUNT_ADD("lca.queries", m);
     for (int i = 0; i < m; ++i) {
-        int u, v;
-        std::cin >> u >> v;
-        std::cout << solver.findLCA(u, v) << "\n";
+        int u = input.readInt();
+        int v = input.readInt();
+        output.writeInt(solver.findLCA(u, v));
+        output.writeChar('\n');
     }
 }
\ No newline at end of file
@@ -3,11 +3,15 @@
 
 #include <vector>
 #include <cmath>
+#include <utility>
+#include "csr_graph.hpp"
+#include "dfs_engine.hpp"
 
 class LCASolver {
 private:
     int n;
-    std::vector<std::vector<int>> graph;
+    std::vector<std::pair<int, int>> edges;
+    CsrGraph graph;
     
     std::vector<int> euler_tour;
     std::vector<int> depth;
@@ -17,7 +21,8 @@ private:
     std::vector<std::vector<int>> sparse_table;
     std::vector<int> log_table;
     
-    void dfs(int u, int p, int d);
+    // Эйлеров обход из root на явном стеке
+    void dfs(int root);
     void buildSparseTable();
     int rmq(int l, int r) const;
     
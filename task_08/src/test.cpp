@@ -207,6 +207,20 @@ TEST(LCATest, VerifyTreeStructure) {
     EXPECT_TRUE(lca == 1 || lca == 3); // Один из возможных вариантов
 }
 
+// Тест 13: Цепочка глубиной 10^6 не переполняет стек вызовов
+TEST(LCATest, DeepPath) {
+    const int n = 1000000;
+    LCASolver solver(n);
+    for (int v = 2; v <= n; ++v) {
+        solver.addEdge(v - 1, v);
+    }
+    solver.build(1);
+    
+    EXPECT_EQ(solver.findLCA(n, n / 2), n / 2);
+    EXPECT_EQ(solver.findLCA(1, n), 1);
+    EXPECT_EQ(solver.findLCA(n - 1, n), n - 1);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
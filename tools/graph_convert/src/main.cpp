@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "csr_graph.hpp"
+#include "fast_input.hpp"
+#include "graph_file.hpp"
+
+// Перевод текстового ввода задач task_01 - task_06 в бинарный формат GraphFile.
+// Раскладка CSR совпадает с той, что строит соответствующий решатель.
+
+namespace {
+
+struct Profile {
+    const char* task;
+    bool undirected;
+    bool weighted;
+    bool one_based;
+    bool has_parameter;     // третье число в первой строке (d в task_05)
+    bool sorted;
+};
+
+const Profile kProfiles[] = {
+    {"task_01", true, false, true, false, true},
+    {"task_02", false, false, false, false, false},
+    {"task_03", false, false, false, false, false},
+    {"task_04", false, true, false, false, false},
+    {"task_05", true, true, false, true, false},
+    {"task_06", false, true, false, false, false},
+};
+
+void printUsage() {
+    std::fprintf(stderr,
+                 "usage: graph_convert <task_01..task_06> <input.txt|-> <output.bin>\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 4) {
+        printUsage();
+        return 2;
+    }
+
+    const Profile* profile = nullptr;
+    for (const auto& candidate : kProfiles) {
+        if (std::string(argv[1]) == candidate.task) {
+            profile = &candidate;
+        }
+    }
+    if (profile == nullptr) {
+        printUsage();
+        return 2;
+    }
+
+    try {
+        std::string input_path = argv[2];
+        std::unique_ptr<FastReader> input = input_path == "-"
+            ? std::make_unique<FastReader>(0)
+            : std::make_unique<FastReader>(input_path);
+
+        int n = input->readInt();
+        int m = input->readInt();
+        long long parameter = profile->has_parameter ? input->readLong() : 0;
+
+        int shift = profile->one_based ? 0 : 1;
+        int rows = profile->one_based ? n + 1 : n;
+
+        std::vector<std::pair<int, int>> edges;
+        std::vector<long long> weights;
+        edges.reserve(m);
+        if (profile->weighted) {
+            weights.reserve(m);
+        }
+
+        for (int i = 0; i < m; ++i) {
+            int u = input->readInt() - shift;
+            int v = input->readInt() - shift;
+            edges.push_back({u, v});
+            if (profile->weighted) {
+                weights.push_back(input->readLong());
+            }
+        }
+
+        CsrGraph graph = profile->weighted
+            ? CsrGraph::fromWeightedEdges(rows, edges, weights, profile->undirected)
+            : CsrGraph::fromEdges(rows, edges, profile->undirected);
+
+        std::uint32_t flags = 0;
+        if (profile->undirected) {
+            flags |= GraphFile::Undirected;
+        }
+        if (profile->one_based) {
+            flags |= GraphFile::OneBased;
+        }
+        if (profile->sorted) {
+            graph.sortNeighbors();
+            flags |= GraphFile::SortedNeighbors;
+        }
+
+        GraphFile::save(argv[3], graph, flags, n, parameter);
+    } catch (const std::exception& error) {
+        std::fprintf(stderr, "graph_convert: %s\n", error.what());
+        return 1;
+    }
+
+    return 0;
+}
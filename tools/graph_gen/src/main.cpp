@@ -0,0 +1,283 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include "fast_output.hpp"
+#include "graph_generator.hpp"
+
+// Генерация входов task_01 - task_08 в их текстовом формате.
+// Граф не хранится целиком: генератор запускается дважды с тем же seed,
+// первый проход считает рёбра для заголовка, второй печатает их.
+
+namespace {
+
+struct Options {
+    std::string task;
+    std::string shape;
+    std::map<std::string, std::string> values;
+
+    long long get(const std::string& key, long long fallback) const {
+        auto it = values.find(key);
+        if (it == values.end()) {
+            return fallback;
+        }
+        char* end = nullptr;
+        long long value = std::strtoll(it->second.c_str(), &end, 10);
+        if (end == it->second.c_str() || *end != '\0') {
+            throw std::invalid_argument("bad value for --" + key + ": " + it->second);
+        }
+        return value;
+    }
+};
+
+void printUsage() {
+    std::fprintf(stderr,
+        "usage: graph_gen <task_01..task_08> [--shape=NAME] [--seed=S] [options]\n"
+        "shapes:\n"
+        "  er       Erdos-Renyi, --n, --m (expected edge count)\n"
+        "  rmat     R-MAT power-law, --scale (2^scale vertices), --m\n"
+        "  grid     --rows, --cols\n"
+        "  path     --n\n"
+        "  broom    --n, --handle (path length before the star)\n"
+        "  tree     random recursive tree, --n\n"
+        "  dag      random DAG, --n, --m\n"
+        "  layered  flow network, --layers, --width, --degree\n"
+        "weights:   --min-weight, --max-weight (task_04 - task_06)\n"
+        "task_05:   --d (degree limit)\n"
+        "task_07:   --n (array size), --queries\n"
+        "task_08:   tree shapes only, --queries\n");
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    options.task = argv[1];
+    for (int i = 2; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument.rfind("--", 0) != 0) {
+            throw std::invalid_argument("unexpected argument: " + argument);
+        }
+        std::string key = argument.substr(2);
+        std::string value;
+        auto equals = key.find('=');
+        if (equals != std::string::npos) {
+            value = key.substr(equals + 1);
+            key = key.substr(0, equals);
+        } else if (i + 1 < argc) {
+            value = argv[++i];
+        } else {
+            throw std::invalid_argument("missing value for --" + key);
+        }
+        if (key == "shape") {
+            options.shape = value;
+        } else {
+            options.values[key] = value;
+        }
+    }
+    return options;
+}
+
+std::string defaultShape(const std::string& task) {
+    if (task == "task_03") {
+        return "dag";
+    }
+    if (task == "task_06") {
+        return "layered";
+    }
+    if (task == "task_08") {
+        return "tree";
+    }
+    return "er";
+}
+
+bool isTreeShape(const std::string& shape) {
+    return shape == "path" || shape == "broom" || shape == "tree";
+}
+
+// Число вершин графа выбранной формы
+int vertexCount(const Options& options) {
+    const std::string& shape = options.shape;
+    if (shape == "rmat") {
+        return 1 << options.get("scale", 10);
+    }
+    if (shape == "grid") {
+        return static_cast<int>(options.get("rows", 32) * options.get("cols", 32));
+    }
+    if (shape == "layered") {
+        return static_cast<int>(options.get("layers", 8) * options.get("width", 16) + 2);
+    }
+    return static_cast<int>(options.get("n", 1000));
+}
+
+void generate(const GraphGenerator& generator, const Options& options, bool directed,
+              const GraphGenerator::EdgeSink& sink) {
+    const std::string& shape = options.shape;
+    long long n = options.get("n", 1000);
+    long long m = options.get("m", 4 * n);
+
+    if (shape == "er") {
+        generator.erdosRenyi(static_cast<int>(n), m, directed, sink);
+    } else if (shape == "rmat") {
+        long long scale = options.get("scale", 10);
+        if (scale < 1 || scale > 30) {
+            throw std::invalid_argument("--scale must be in [1, 30]");
+        }
+        generator.rmat(static_cast<int>(scale), options.get("m", 8LL << scale), sink);
+    } else if (shape == "grid") {
+        generator.grid(static_cast<int>(options.get("rows", 32)),
+                       static_cast<int>(options.get("cols", 32)), sink);
+    } else if (shape == "path") {
+        generator.path(static_cast<int>(n), sink);
+    } else if (shape == "broom") {
+        generator.broom(static_cast<int>(n), static_cast<int>(options.get("handle", n / 2)), sink);
+    } else if (shape == "tree") {
+        generator.randomTree(static_cast<int>(n), sink);
+    } else if (shape == "dag") {
+        generator.randomDag(static_cast<int>(n), m, sink);
+    } else if (shape == "layered") {
+        generator.layeredNetwork(static_cast<int>(options.get("layers", 8)),
+                                 static_cast<int>(options.get("width", 16)),
+                                 static_cast<int>(options.get("degree", 3)), sink);
+    } else {
+        throw std::invalid_argument("unknown shape: " + shape);
+    }
+}
+
+void writeArrayQueries(const Options& options, std::uint64_t seed, FastWriter& output) {
+    int n = static_cast<int>(options.get("n", 1000));
+    long long queries = options.get("queries", n);
+    long long low = options.get("min-weight", -1000000000);
+    long long high = options.get("max-weight", 1000000000);
+    SeededRandom random(seed);
+
+    output.writeInt(n);
+    output.writeChar(' ');
+    output.writeInt(queries);
+    output.writeChar('\n');
+    for (int i = 0; i < n; ++i) {
+        output.writeInt(random.nextInRange(low, high));
+        output.writeChar(i + 1 < n ? ' ' : '\n');
+    }
+    for (long long q = 0; q < queries; ++q) {
+        if (random.nextBelow(2) == 0) {
+            long long l = random.nextInRange(1, n);
+            long long r = random.nextInRange(1, n);
+            output.writeString("1 ");
+            output.writeInt(std::min(l, r));
+            output.writeChar(' ');
+            output.writeInt(std::max(l, r));
+        } else {
+            output.writeString("2 ");
+            output.writeInt(random.nextInRange(1, n));
+            output.writeChar(' ');
+            output.writeInt(random.nextInRange(low, high));
+        }
+        output.writeChar('\n');
+    }
+}
+
+void writeTreeQueries(const GraphGenerator& generator, const Options& options,
+                      std::uint64_t seed, FastWriter& output) {
+    if (!isTreeShape(options.shape)) {
+        throw std::invalid_argument("task_08 needs a tree shape: path, broom or tree");
+    }
+    int n = vertexCount(options);
+    long long queries = options.get("queries", n);
+
+    output.writeInt(n);
+    output.writeChar(' ');
+    output.writeInt(queries);
+    output.writeChar('\n');
+    // Дети идут по возрастанию, так что это и есть родители вершин 2..n
+    generate(generator, options, false, [&output](int parent, int) {
+        output.writeInt(parent + 1);
+        output.writeChar('\n');
+    });
+
+    SeededRandom random(seed ^ 0x5DEECE66DULL);
+    for (long long q = 0; q < queries; ++q) {
+        output.writeInt(random.nextInRange(1, n));
+        output.writeChar(' ');
+        output.writeInt(random.nextInRange(1, n));
+        output.writeChar('\n');
+    }
+}
+
+void writeGraph(const GraphGenerator& generator, const Options& options,
+                std::uint64_t seed, FastWriter& output) {
+    const std::string& task = options.task;
+    bool directed = task != "task_01" && task != "task_05";
+    bool weighted = task == "task_04" || task == "task_05" || task == "task_06";
+    long long low = options.get("min-weight", 1);
+    long long high = options.get("max-weight", task == "task_06" ? 100 : 1000);
+    if (low > high) {
+        throw std::invalid_argument("--min-weight exceeds --max-weight");
+    }
+
+    long long edges = 0;
+    generate(generator, options, directed, [&edges](int, int) {
+        ++edges;
+    });
+
+    output.writeInt(vertexCount(options));
+    output.writeChar(' ');
+    output.writeInt(edges);
+    if (task == "task_05") {
+        output.writeChar(' ');
+        output.writeInt(options.get("d", 3));
+    }
+    output.writeChar('\n');
+
+    SeededRandom weights(seed ^ 0x2545F4914F6CDD1DULL);
+    generate(generator, options, directed, [&](int u, int v) {
+        output.writeInt(u + 1);
+        output.writeChar(' ');
+        output.writeInt(v + 1);
+        if (weighted) {
+            output.writeChar(' ');
+            output.writeInt(weights.nextInRange(low, high));
+        }
+        output.writeChar('\n');
+    });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage();
+        return 2;
+    }
+
+    try {
+        Options options = parseOptions(argc, argv);
+        const std::string& task = options.task;
+        if (task.size() != 7 || task.rfind("task_0", 0) != 0 || task[6] < '1' || task[6] > '8') {
+            printUsage();
+            return 2;
+        }
+        if (options.shape.empty()) {
+            options.shape = defaultShape(task);
+        }
+
+        std::uint64_t seed = static_cast<std::uint64_t>(options.get("seed", 1));
+        GraphGenerator generator(seed);
+        FastWriter output;
+
+        if (task == "task_07") {
+            writeArrayQueries(options, seed, output);
+        } else if (task == "task_08") {
+            writeTreeQueries(generator, options, seed, output);
+        } else {
+            writeGraph(generator, options, seed, output);
+        }
+    } catch (const std::exception& error) {
+        std::fprintf(stderr, "graph_gen: %s\n", error.what());
+        return 1;
+    }
+
+    return 0;
+}